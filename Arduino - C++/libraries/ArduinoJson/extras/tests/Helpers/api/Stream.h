@@ -11,4 +11,9 @@ class Stream  // : public Print
   virtual ~Stream() {}
   virtual int read() = 0;
   virtual size_t readBytes(char* buffer, size_t length) = 0;
+
+  // pure virtual in Arduino; returns 0 here so that tests can ignore it
+  virtual int available() {
+    return 0;
+  }
 };
@@ -0,0 +1,108 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ArduinoJson/Deserialization/BufferedStreamReader.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+using namespace ArduinoJson;
+
+// Delivers the input in bursts of `burst` bytes, like a network client
+class BurstStream : public Stream {
+ public:
+  BurstStream(const char* input, size_t burst)
+      : input_(input), burst_(burst) {}
+
+  int available() override {
+    size_t left = input_.size() - position_;
+    size_t ready = burst_ - position_ % burst_;
+    return static_cast<int>(ready < left ? ready : left);
+  }
+
+  int read() override {
+    char c;
+    return readBytes(&c, 1) ? static_cast<unsigned char>(c) : -1;
+  }
+
+  size_t readBytes(char* buffer, size_t length) override {
+    calls++;
+    size_t left = input_.size() - position_;  // no timeout: what's left
+    size_t n = length < left ? length : left;
+    input_.copy(buffer, n, position_);
+    position_ += n;
+    return n;
+  }
+
+  size_t calls = 0;
+
+ private:
+  std::string input_;
+  size_t burst_;
+  size_t position_ = 0;
+};
+
+TEST_CASE("BufferedStreamReader") {
+  SECTION("reads what's available in one call") {
+    BurstStream stream("{\"hello\":\"world\",\"answer\":42}", 8);
+    BufferedStreamReader<64> reader(stream);
+    JsonDocument doc;
+
+    DeserializationError err = deserializeJson(doc, reader);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["hello"] == "world");
+    REQUIRE(doc["answer"] == 42);
+    REQUIRE(stream.calls == 4);  // 29 bytes in bursts of 8
+  }
+
+  SECTION("reads at most Capacity bytes at once") {
+    BurstStream stream("[1,2,3,4,5,6,7,8]", 100);
+    BufferedStreamReader<4> reader(stream);
+    JsonDocument doc;
+
+    DeserializationError err = deserializeJson(doc, reader);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.size() == 8);
+    REQUIRE(stream.calls == 5);  // 17 bytes in chunks of 4
+  }
+
+  SECTION("waits for one byte when nothing is available") {
+    BurstStream stream("[1]", 100);
+    BufferedStreamReader<64> reader(stream);
+    stream.calls = 0;
+
+    REQUIRE(reader.available() == 3);
+    REQUIRE(reader.read() == '[');
+    REQUIRE(reader.available() == 2);
+    REQUIRE(reader.read() == '1');
+    REQUIRE(reader.read() == ']');
+    REQUIRE(reader.read() == -1);
+    REQUIRE(stream.calls == 2);
+  }
+
+  SECTION("keeps the bytes read past the document") {
+    BurstStream stream("{\"a\":1}\n{\"a\":2}\n", 100);
+    BufferedStreamReader<64> reader(stream);
+    JsonDocument doc;
+
+    deserializeJson(doc, reader);
+    REQUIRE(doc["a"] == 1);
+    deserializeJson(doc, reader);
+    REQUIRE(doc["a"] == 2);
+  }
+
+  SECTION("readBytes() serves the buffer, then the stream") {
+    BurstStream stream("0123456789", 4);
+    BufferedStreamReader<64> reader(stream);
+    char buffer[11] = {0};
+
+    REQUIRE(reader.peek() == '0');
+    REQUIRE(reader.readBytes(buffer, 10) == 10);
+    REQUIRE(std::string(buffer) == "0123456789");
+  }
+}
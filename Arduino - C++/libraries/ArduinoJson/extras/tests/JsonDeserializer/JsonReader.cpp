@@ -0,0 +1,316 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Json/JsonReader.hpp>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ArduinoJson;
+
+// Renders the events as a compact string, for easy comparison
+template <typename TReader>
+static std::string events(TReader& reader) {
+  std::string s;
+  for (;;) {
+    switch (reader.next()) {
+      case JsonEvent::BeginObject:
+        s += "{";
+        break;
+      case JsonEvent::EndObject:
+        s += "}";
+        break;
+      case JsonEvent::BeginArray:
+        s += "[";
+        break;
+      case JsonEvent::EndArray:
+        s += "]";
+        break;
+      case JsonEvent::Key:
+        s += std::string("K:") + reader.text() + " ";
+        break;
+      case JsonEvent::String:
+        s += std::string("S:") + reader.text() + " ";
+        break;
+      case JsonEvent::Number:
+        s += std::string("N:") + reader.text() + " ";
+        break;
+      case JsonEvent::Boolean:
+        s += reader.asBool() ? "T " : "F ";
+        break;
+      case JsonEvent::Null:
+        s += "null ";
+        break;
+      case JsonEvent::End:
+        return s;
+      default:
+        return s + "error:" + reader.error().c_str();
+    }
+  }
+}
+
+static std::string events(const char* json, size_t bufferSize = 32,
+                          uint8_t nestingLimit = 10) {
+  std::vector<char> buffer(bufferSize);
+  auto reader =
+      makeJsonReader(json, buffer.data(), buffer.size(),
+                     DeserializationOption::NestingLimit(nestingLimit));
+  return events(reader);
+}
+
+TEST_CASE("JsonReader") {
+  SECTION("scalars") {
+    REQUIRE(events("42") == "N:42 ");
+    REQUIRE(events(" -1.5e3 ") == "N:-1.5e3 ");
+    REQUIRE(events("\"hello\"") == "S:hello ");
+    REQUIRE(events("'single'") == "S:single ");
+    REQUIRE(events("true") == "T ");
+    REQUIRE(events("false") == "F ");
+    REQUIRE(events("null") == "null ");
+  }
+
+  SECTION("containers") {
+    REQUIRE(events("{}") == "{}");
+    REQUIRE(events("[]") == "[]");
+    REQUIRE(events("{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":\"e\"}}") ==
+            "{K:a N:1 K:b [T F null ]K:c {K:d S:e }}");
+    REQUIRE(events(" [ 1 , [ ] , { } ] ") == "[N:1 []{}]");
+  }
+
+  SECTION("escape sequences") {
+    REQUIRE(events("\"a\\\"b\\\\c\\/d\\n\"") == "S:a\"b\\c/d\n ");
+    REQUIRE(events("\"\\u00e9\\u20AC\"") == "S:\xC3\xA9\xE2\x82\xAC ");
+    REQUIRE(events("\"\\uD83D\\uDE00\"") == "S:\xF0\x9F\x98\x80 ");
+  }
+
+  SECTION("stops after the first value") {
+    REQUIRE(events("{}{}") == "{}");
+  }
+
+  SECTION("errors") {
+    REQUIRE(events("") == "error:EmptyInput");
+    REQUIRE(events("  ") == "error:EmptyInput");
+    REQUIRE(events("{\"a\":") == "{K:a error:IncompleteInput");
+    REQUIRE(events("[1,") == "[N:1 error:IncompleteInput");
+    REQUIRE(events("\"abc") == "error:IncompleteInput");
+    REQUIRE(events("{\"a\" 1}") == "{K:a error:InvalidInput");
+    REQUIRE(events("[1,]") == "[N:1 error:InvalidInput");
+    REQUIRE(events("[1}") == "[N:1 error:InvalidInput");
+    REQUIRE(events("{1:2}") == "{error:InvalidInput");
+    REQUIRE(events("tru") == "error:IncompleteInput");
+    REQUIRE(events("trux") == "error:InvalidInput");
+    REQUIRE(events("1.2.3") == "error:InvalidInput");
+    REQUIRE(events("1.2.3.4", 8) == "error:InvalidInput");  // fills buffer
+    REQUIRE(events("\"\\x\"") == "error:InvalidInput");
+    REQUIRE(events("\"\\uD83D\"") == "error:InvalidInput");
+  }
+
+  SECTION("NoMemory when the buffer is too small") {
+    REQUIRE(events("[\"abc\"]", 4) == "[S:abc ]");
+    REQUIRE(events("[\"abcd\"]", 4) == "[error:NoMemory");
+    REQUIRE(events("123456", 4) == "error:NoMemory");
+  }
+
+  SECTION("allowTruncation()") {
+    char buffer[4];
+    auto reader = makeJsonReader("{\"abcd\":123456}", buffer);
+    reader.allowTruncation(true);
+    reader.next();
+    REQUIRE(reader.next() == JsonEvent::Key);
+    REQUIRE(reader.text() == std::string("abc"));
+    REQUIRE(reader.next() == JsonEvent::Number);
+    REQUIRE(reader.text() == std::string("123"));
+    REQUIRE(reader.next() == JsonEvent::EndObject);
+  }
+
+  SECTION("TooDeep") {
+    REQUIRE(events("[[1]]", 32, 2) == "[[N:1 ]]");
+    REQUIRE(events("[[1]]", 32, 1) == "[error:TooDeep");
+    REQUIRE(events("[[1]]", 32, 0) == "error:TooDeep");
+  }
+
+  SECTION("remains in error") {
+    char buffer[8];
+    auto reader = makeJsonReader("[}", buffer);
+    reader.next();
+    REQUIRE(reader.next() == JsonEvent::Error);
+    REQUIRE(reader.next() == JsonEvent::Error);
+    REQUIRE(reader.error() == DeserializationError::InvalidInput);
+  }
+
+  SECTION("depth()") {
+    char buffer[8];
+    auto reader = makeJsonReader("{\"a\":[1]}", buffer);
+    REQUIRE(reader.depth() == 0);
+    reader.next();  // {
+    REQUIRE(reader.depth() == 1);
+    reader.next();  // a
+    reader.next();  // [
+    REQUIRE(reader.depth() == 2);
+    reader.next();  // 1
+    reader.next();  // ]
+    REQUIRE(reader.depth() == 1);
+    reader.next();  // }
+    REQUIRE(reader.depth() == 0);
+  }
+}
+
+TEST_CASE("JsonReader conversions") {
+  char buffer[64];
+
+  SECTION("asInteger()") {
+    auto reader = makeJsonReader(
+        "[0,-42,9223372036854775807,-9223372036854775808,"
+        "9223372036854775808,3.9,\"1234\",\"abc\",true]",
+        buffer);
+    reader.next();
+    std::vector<int64_t> values;
+    while (reader.next() != JsonEvent::EndArray)
+      values.push_back(reader.asInteger());
+    REQUIRE(values == std::vector<int64_t>{0, -42, INT64_MAX, INT64_MIN, 0, 3,
+                                           1234, 0, 0});
+  }
+
+  SECTION("asDouble()") {
+    auto reader = makeJsonReader(
+        "[0.1,-2.5e-3,3.14159265358979323846264338327950288,\"1e3\",null]",
+        buffer);
+    reader.next();
+    std::vector<double> values;
+    while (reader.next() != JsonEvent::EndArray)
+      values.push_back(reader.asDouble());
+    REQUIRE(values ==
+            std::vector<double>{0.1, -2.5e-3, 3.141592653589793, 1000, 0});
+  }
+}
+
+TEST_CASE("JsonReader::skip()") {
+  char buffer[8];
+
+  SECTION("skips a container with strings larger than the buffer") {
+    auto reader = makeJsonReader(
+        "[{\"long key\":\"a long string with ] and \\\" inside\"},2]", buffer);
+    REQUIRE(reader.next() == JsonEvent::BeginArray);
+    REQUIRE(reader.next() == JsonEvent::BeginObject);
+    reader.skip();
+    REQUIRE(reader.event() == JsonEvent::EndObject);
+    REQUIRE(reader.next() == JsonEvent::Number);
+    REQUIRE(reader.asInteger() == 2);
+    REQUIRE(reader.next() == JsonEvent::EndArray);
+    REQUIRE(reader.next() == JsonEvent::End);
+  }
+
+  SECTION("skips the value of a key") {
+    auto reader = makeJsonReader("{\"a\":[[1],{}],\"b\":2}", buffer);
+    reader.next();
+    REQUIRE(reader.next() == JsonEvent::Key);
+    reader.skip();
+    REQUIRE(reader.event() == JsonEvent::EndArray);
+    REQUIRE(reader.next() == JsonEvent::Key);
+    REQUIRE(reader.text() == std::string("b"));
+    reader.skip();
+    REQUIRE(reader.event() == JsonEvent::Number);
+    REQUIRE(reader.next() == JsonEvent::EndObject);
+  }
+
+  SECTION("skips a string value larger than the buffer") {
+    auto reader = makeJsonReader("{\"a\":\"a long string\",\"b\":2}", buffer);
+    reader.next();
+    reader.next();
+    reader.skip();
+    REQUIRE(reader.event() == JsonEvent::String);
+    REQUIRE(reader.next() == JsonEvent::Key);
+    REQUIRE(reader.text() == std::string("b"));
+  }
+
+  SECTION("reports truncated input") {
+    auto reader = makeJsonReader("[[1,2", buffer);
+    reader.next();
+    reader.next();
+    reader.skip();
+    REQUIRE(reader.event() == JsonEvent::Error);
+    REQUIRE(reader.error() == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("JsonReader::subtree()") {
+  char buffer[16];
+  auto reader = makeJsonReader("{\"meds\":[{\"a\":\"}\"},{\"b\":[2]}],\"n\":2}",
+                               buffer);
+  reader.next();
+  reader.next();
+  REQUIRE(reader.next() == JsonEvent::BeginArray);
+  REQUIRE(reader.next() == JsonEvent::BeginObject);
+
+  auto first = reader.subtree();
+  char chunk[64];
+  size_t n = first.readBytes(chunk, sizeof(chunk));
+  REQUIRE(std::string(chunk, n) == "{\"a\":\"}\"}");
+  REQUIRE(reader.event() == JsonEvent::EndObject);
+
+  REQUIRE(reader.next() == JsonEvent::BeginObject);
+  auto second = reader.subtree();
+  n = second.readBytes(chunk, sizeof(chunk));
+  REQUIRE(std::string(chunk, n) == "{\"b\":[2]}");
+
+  REQUIRE(reader.next() == JsonEvent::EndArray);
+  REQUIRE(reader.next() == JsonEvent::Key);
+  REQUIRE(reader.next() == JsonEvent::Number);
+  REQUIRE(reader.next() == JsonEvent::EndObject);
+  REQUIRE(reader.next() == JsonEvent::End);
+}
+
+TEST_CASE("JsonReader::read()") {
+  char buffer[16];
+  JsonDocument doc;
+
+  SECTION("materializes one element at a time") {
+    auto reader =
+        makeJsonReader("[{\"name\":\"a\",\"dose\":1},{\"name\":\"b\"}]", buffer);
+    reader.next();
+    REQUIRE(reader.next() == JsonEvent::BeginObject);
+    REQUIRE(reader.read(doc) == DeserializationError::Ok);
+    REQUIRE(doc["name"] == "a");
+    REQUIRE(doc["dose"] == 1);
+    REQUIRE(reader.event() == JsonEvent::EndObject);
+
+    REQUIRE(reader.next() == JsonEvent::BeginObject);
+    REQUIRE(reader.read(doc) == DeserializationError::Ok);
+    REQUIRE(doc["name"] == "b");
+    REQUIRE(reader.next() == JsonEvent::EndArray);
+  }
+
+  SECTION("rejects scalars") {
+    auto reader = makeJsonReader("[1]", buffer);
+    reader.next();
+    reader.next();
+    REQUIRE(reader.read(doc) == DeserializationError::InvalidInput);
+  }
+}
+
+TEST_CASE("JsonReader streams documents larger than the buffer") {
+  std::stringstream json;
+  json << "{\"documents\":[";
+  for (int i = 0; i < 10000; i++)
+    json << (i ? "," : "") << "{\"fields\":{\"dose\":{\"integerValue\":\"" << i
+         << "\"}}}";
+  json << "]}";
+
+  char buffer[16];
+  auto reader = makeJsonReader(json, buffer);
+  int64_t sum = 0;
+  int count = 0;
+  while (reader.next() != JsonEvent::End) {
+    REQUIRE(reader.event() != JsonEvent::Error);
+    if (reader.event() == JsonEvent::String) {
+      sum += reader.asInteger();
+      count++;
+    }
+  }
+  REQUIRE(count == 10000);
+  REQUIRE(sum == 49995000);
+}
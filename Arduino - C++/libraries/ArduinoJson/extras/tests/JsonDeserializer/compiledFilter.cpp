@@ -0,0 +1,130 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+using namespace ArduinoJson;
+using DeserializationOption::CompiledFilter;
+using DeserializationOption::Filter;
+
+// Deserializes the input with both filters and checks they keep the same thing
+static std::string filterBoth(const char* filterJson, const char* input) {
+  JsonDocument filterDoc;
+  deserializeJson(filterDoc, filterJson);
+  CompiledFilter<32> compiled(filterDoc);
+  REQUIRE(compiled.overflowed() == false);
+
+  JsonDocument expected, actual;
+  DeserializationError expectedError =
+      deserializeJson(expected, input, Filter(filterDoc));
+  DeserializationError actualError = deserializeJson(actual, input, compiled);
+  REQUIRE(actualError == expectedError);
+
+  std::string expectedJson, actualJson;
+  serializeJson(expected, expectedJson);
+  serializeJson(actual, actualJson);
+  REQUIRE(actualJson == expectedJson);
+  return actualJson;
+}
+
+TEST_CASE("CompiledFilter") {
+  SECTION("keeps the same members as Filter") {
+    CHECK(filterBoth("{\"a\":true}", "{\"a\":1,\"b\":2}") == "{\"a\":1}");
+    CHECK(filterBoth("{\"a\":true,\"c\":true}", "{\"c\":3,\"b\":2,\"a\":1}") ==
+          "{\"c\":3,\"a\":1}");
+    CHECK(filterBoth("{\"a\":false}", "{\"a\":1}") == "{}");
+    CHECK(filterBoth("{}", "{\"a\":1}") == "{}");
+    CHECK(filterBoth("true", "{\"a\":[1,{\"b\":2}]}") ==
+          "{\"a\":[1,{\"b\":2}]}");
+    CHECK(filterBoth("false", "{\"a\":1}") == "null");
+  }
+
+  SECTION("keeps a member with a null value for other truthy values") {
+    CHECK(filterBoth("{\"a\":42}", "{\"a\":{\"b\":1}}") == "{\"a\":null}");
+    CHECK(filterBoth("{\"a\":\"x\"}", "{\"a\":1}") == "{\"a\":null}");
+  }
+
+  SECTION("nested objects") {
+    CHECK(filterBoth("{\"a\":{\"b\":true}}",
+                     "{\"a\":{\"b\":1,\"c\":2},\"d\":3}") ==
+          "{\"a\":{\"b\":1}}");
+    CHECK(filterBoth("{\"a\":{\"b\":true}}", "{\"a\":[1,2]}") ==
+          "{\"a\":null}");
+  }
+
+  SECTION("arrays use their first element") {
+    CHECK(filterBoth("[{\"id\":true}]", "[{\"id\":1,\"x\":2},{\"id\":3}]") ==
+          "[{\"id\":1},{\"id\":3}]");
+    CHECK(filterBoth("{\"list\":[true]}", "{\"list\":[1,2,3]}") ==
+          "{\"list\":[1,2,3]}");
+    CHECK(filterBoth("[]", "[1,2]") == "[]");
+  }
+
+  SECTION("wildcard") {
+    CHECK(filterBoth("{\"*\":{\"v\":true}}",
+                     "{\"x\":{\"v\":1,\"w\":2},\"y\":{\"v\":3}}") ==
+          "{\"x\":{\"v\":1},\"y\":{\"v\":3}}");
+    CHECK(filterBoth("{\"a\":false,\"*\":true}", "{\"a\":1,\"b\":2}") ==
+          "{\"b\":2}");
+    CHECK(filterBoth("{\"a\":null,\"*\":true}", "{\"a\":1,\"b\":2}") ==
+          "{\"a\":1,\"b\":2}");
+  }
+
+  SECTION("keys that only differ by length") {
+    CHECK(filterBoth("{\"ab\":true}", "{\"a\":1,\"ab\":2,\"abc\":3}") ==
+          "{\"ab\":2}");
+  }
+
+  SECTION("one state per value of the filter") {
+    JsonDocument filterDoc;
+    deserializeJson(filterDoc, "{\"a\":{\"b\":true,\"c\":[true]},\"d\":true}");
+    CompiledFilter<32> compiled(filterDoc);
+    CHECK(compiled.size() == 6);
+    CHECK(compiled.overflowed() == false);
+  }
+
+  SECTION("allows everything when the table is too small") {
+    JsonDocument filterDoc;
+    deserializeJson(filterDoc, "{\"a\":true,\"b\":true,\"c\":true}");
+    CompiledFilter<3> compiled(filterDoc);
+    CHECK(compiled.overflowed() == true);
+
+    JsonDocument doc;
+    deserializeJson(doc, "{\"a\":1,\"z\":2}", compiled);
+    CHECK(doc.as<std::string>() == "{\"a\":1,\"z\":2}");
+  }
+
+  SECTION("accepts a nesting limit in any order") {
+    JsonDocument filterDoc;
+    deserializeJson(filterDoc, "{\"a\":true}");
+    CompiledFilter<8> compiled(filterDoc);
+    JsonDocument doc;
+
+    CHECK(deserializeJson(doc, "{\"a\":[[1]]}", compiled,
+                          DeserializationOption::NestingLimit(1)) ==
+          DeserializationError::TooDeep);
+    CHECK(deserializeJson(doc, "{\"a\":[[1]]}",
+                          DeserializationOption::NestingLimit(1), compiled) ==
+          DeserializationError::TooDeep);
+    CHECK(deserializeJson(doc, "{\"a\":[[1]]}", compiled,
+                          DeserializationOption::NestingLimit(3)) ==
+          DeserializationError::Ok);
+    CHECK(doc.as<std::string>() == "{\"a\":[[1]]}");
+  }
+
+  SECTION("can be reused") {
+    JsonDocument filterDoc;
+    deserializeJson(filterDoc, "{\"t\":true}");
+    CompiledFilter<8> compiled(filterDoc);
+    JsonDocument doc;
+
+    for (int i = 0; i < 3; i++) {
+      deserializeJson(doc, "{\"t\":21.5,\"h\":40}", compiled);
+      CHECK(doc.as<std::string>() == "{\"t\":21.5}");
+    }
+  }
+}
@@ -0,0 +1,137 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Json/StructReader.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+using namespace ArduinoJson;
+
+namespace {
+struct Point {
+  int x, y;
+};
+
+struct Dose {
+  char name[8];
+  uint8_t hour, minute;
+  uint8_t days[3];
+  size_t dayCount;
+  bool enabled;
+  float amount;
+  Point points[2];
+  size_t pointCount;
+};
+}  // namespace
+
+namespace ArduinoJson {
+template <>
+struct Converter<Point> {
+  template <typename TBinder>
+  static void bind(TBinder& b, Point& p) {
+    b.field("x", p.x);
+    b.field("y", p.y);
+  }
+};
+
+template <>
+struct Converter<Dose> {
+  template <typename TBinder>
+  static void bind(TBinder& b, Dose& dose) {
+    b.field("name", dose.name);
+    b.field("time/hour", dose.hour);
+    b.field("time/minute", dose.minute);
+    b.field("days", dose.days, dose.dayCount);
+    b.field("enabled", dose.enabled);
+    b.field("amount", dose.amount);
+    b.field("points", dose.points, dose.pointCount);
+  }
+};
+}  // namespace ArduinoJson
+
+TEST_CASE("deserializeStruct()") {
+  Dose dose = {};
+
+  SECTION("fills the fields") {
+    DeserializationError err = deserializeStruct(
+        dose,
+        "{\"name\":\"aspirin\",\"time\":{\"hour\":8,\"minute\":30},"
+        "\"days\":[1,3,5],\"enabled\":true,\"amount\":0.5,"
+        "\"points\":[{\"x\":1,\"y\":2},{\"y\":4,\"x\":3}]}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(dose.name == std::string("aspirin"));
+    REQUIRE(dose.hour == 8);
+    REQUIRE(dose.minute == 30);
+    REQUIRE(dose.dayCount == 3);
+    REQUIRE(dose.days[2] == 5);
+    REQUIRE(dose.enabled == true);
+    REQUIRE(dose.amount == 0.5f);
+    REQUIRE(dose.pointCount == 2);
+    REQUIRE(dose.points[1].x == 3);
+    REQUIRE(dose.points[1].y == 4);
+  }
+
+  SECTION("skips unknown members") {
+    DeserializationError err = deserializeStruct(
+        dose,
+        "{\"id\":[1,{\"a\":2}],\"time\":{\"zone\":\"UTC\",\"hour\":9},"
+        "\"note\":\"a string longer than the buffer used to read tokens, "
+        "which is only 64 bytes by default\",\"minute\":10,\"hour\":11}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(dose.hour == 9);
+    REQUIRE(dose.minute == 0);
+  }
+
+  SECTION("truncates strings and arrays") {
+    DeserializationError err = deserializeStruct(
+        dose, "{\"name\":\"paracetamol\",\"days\":[1,2,3,4,[5]],\"x\":1}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(dose.name == std::string("paracet"));
+    REQUIRE(dose.dayCount == 3);
+    REQUIRE(dose.days[2] == 3);
+  }
+
+  SECTION("zeroes fields with the wrong type") {
+    dose.hour = 1;
+    dose.name[0] = 'x';
+    DeserializationError err = deserializeStruct(
+        dose, "{\"time\":{\"hour\":\"soon\"},\"name\":{\"a\":1},\"days\":3}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(dose.hour == 0);
+    REQUIRE(dose.name == std::string(""));
+    REQUIRE(dose.dayCount == 0);
+  }
+
+  SECTION("zeroes integers out of range") {
+    DeserializationError err =
+        deserializeStruct(dose, "{\"time\":{\"hour\":256,\"minute\":-1}}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(dose.hour == 0);
+    REQUIRE(dose.minute == 0);
+  }
+
+  SECTION("InvalidInput if not an object") {
+    REQUIRE(deserializeStruct(dose, "[1]") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("reports parse errors") {
+    REQUIRE(deserializeStruct(dose, "{\"name\":\"abc") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(deserializeStruct(dose, "") == DeserializationError::EmptyInput);
+  }
+
+  SECTION("TooDeep") {
+    REQUIRE(deserializeStruct(dose, "{\"points\":[{\"x\":1}]}",
+                              DeserializationOption::NestingLimit(2)) ==
+            DeserializationError::TooDeep);
+  }
+}
@@ -0,0 +1,99 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Json/LazyNumbers.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+using namespace ArduinoJson;
+
+TEST_CASE("deserializeJsonLazy()") {
+  JsonDocument doc;
+  char buffer[32];
+
+  SECTION("builds the same tree as deserializeJson()") {
+    DeserializationError err = deserializeJsonLazy(
+        doc, "{\"a\":[true,null,\"x\"],\"b\":{\"c\":\"d\"},\"e\":false}",
+        buffer);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["a"][0] == true);
+    REQUIRE(doc["a"][1].isNull());
+    REQUIRE(doc["a"][2] == "x");
+    REQUIRE(doc["b"]["c"] == "d");
+    REQUIRE(doc["e"] == false);
+  }
+
+  SECTION("writes back the original text of the numbers") {
+    const char* json = "{\"a\":1.10,\"b\":[1e3,-0,12345678901234567890123]}";
+    DeserializationError err = deserializeJsonLazy(doc, json, buffer);
+
+    REQUIRE(err == DeserializationError::Ok);
+    std::string output;
+    serializeJson(doc, output);
+    REQUIRE(output == json);
+  }
+
+  SECTION("accepts a scalar at the root") {
+    REQUIRE(deserializeJsonLazy(doc, "42", buffer) ==
+            DeserializationError::Ok);
+    REQUIRE(lazyAs<int>(doc.as<JsonVariant>()) == 42);
+  }
+
+  SECTION("reports parse errors") {
+    REQUIRE(deserializeJsonLazy(doc, "[1,", buffer) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(deserializeJsonLazy(doc, "[1.2.3]", buffer) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJsonLazy(doc, "[\"a string longer than 32 bytes...\"]",
+                                buffer) == DeserializationError::NoMemory);
+  }
+}
+
+TEST_CASE("lazyAs()") {
+  JsonDocument doc;
+  char buffer[32];
+  deserializeJsonLazy(
+      doc, "{\"i\":-42,\"u\":4294967295,\"f\":1.5,\"e\":2E2,\"s\":\"7\"}",
+      buffer);
+
+  SECTION("converts integers") {
+    REQUIRE(lazyAs<int>(doc["i"]) == -42);
+    REQUIRE(lazyAs<unsigned long>(doc["u"]) == 4294967295UL);
+  }
+
+  SECTION("converts floats") {
+    REQUIRE(lazyAs<float>(doc["f"]) == 1.5f);
+    REQUIRE(lazyAs<double>(doc["e"]) == 200.0);
+    REQUIRE(lazyAs<int>(doc["f"]) == 1);
+  }
+
+  SECTION("caches the value in place of the text") {
+    REQUIRE(doc["f"].is<double>() == false);
+    lazyAs<double>(doc["f"]);
+    REQUIRE(doc["f"].is<double>() == true);
+    REQUIRE(doc["f"].as<double>() == 1.5);
+  }
+
+  SECTION("converts numbers of 63 chars or more") {
+    char big[128];
+    deserializeJsonLazy(
+        doc,
+        "[1234567890123456789012345678901234567890123456789012345678901234567"
+        "890,-0.00000000000000000000000000000000000000000000000000000000000000"
+        "00000125e-3]",
+        big);
+
+    REQUIRE(lazyAs<double>(doc[0]) == 1.2345678901234568e69);
+    REQUIRE(lazyAs<double>(doc[1]) == -1.25e-71);
+  }
+
+  SECTION("behaves like as<T>() for other values") {
+    REQUIRE(lazyAs<const char*>(doc["s"]) == std::string("7"));
+    REQUIRE(lazyAs<int>(doc["s"]) == 7);
+    REQUIRE(lazyAs<int>(doc["missing"]) == 0);
+  }
+}
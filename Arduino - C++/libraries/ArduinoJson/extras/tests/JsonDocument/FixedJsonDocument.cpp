@@ -0,0 +1,141 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Document/FixedJsonDocument.hpp>
+#include <catch.hpp>
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+using namespace ArduinoJson;
+
+static bool isAligned(void* p) {
+  return reinterpret_cast<uintptr_t>(p) % alignof(detail::ArenaAlignment) ==
+         0;
+}
+
+TEST_CASE("ArenaAllocator") {
+  uint8_t buffer[257];
+  ArenaAllocator arena(buffer + 1, 256);  // misaligned on purpose
+
+  REQUIRE(arena.capacity() <= 256);
+  REQUIRE(arena.size() == 0);
+
+  SECTION("returns aligned blocks") {
+    void* p1 = arena.allocate(1);
+    void* p2 = arena.allocate(3);
+    REQUIRE(p1 != nullptr);
+    REQUIRE(p2 != nullptr);
+    REQUIRE(isAligned(p1));
+    REQUIRE(isAligned(p2));
+    REQUIRE(p1 != p2);
+  }
+
+  SECTION("recycles the top block") {
+    void* p1 = arena.allocate(16);
+    size_t size = arena.size();
+    void* p2 = arena.allocate(16);
+    arena.deallocate(p2);
+    REQUIRE(arena.size() == size);
+    REQUIRE(arena.allocate(16) == p2);
+    (void)p1;
+  }
+
+  SECTION("recycles other blocks when the ones above are freed") {
+    void* p1 = arena.allocate(16);
+    void* p2 = arena.allocate(16);
+    arena.deallocate(p1);
+    REQUIRE(arena.size() > 0);
+    arena.deallocate(p2);
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.peak() > 0);
+  }
+
+  SECTION("resizes the top block in place") {
+    void* p = arena.allocate(8);
+    REQUIRE(arena.reallocate(p, 64) == p);
+    REQUIRE(arena.reallocate(p, 4) == p);
+  }
+
+  SECTION("moves other blocks when they grow") {
+    char* p1 = static_cast<char*>(arena.allocate(8));
+    void* p2 = arena.allocate(8);
+    strcpy(p1, "hello");
+    char* p3 = static_cast<char*>(arena.reallocate(p1, 32));
+    REQUIRE(p3 != p1);
+    REQUIRE(std::string(p3) == "hello");
+    (void)p2;
+  }
+
+  SECTION("fails when full") {
+    REQUIRE(arena.allocate(300) == nullptr);
+    REQUIRE(arena.overflowed() == true);
+    REQUIRE(arena.size() == 0);
+  }
+
+  SECTION("keeps the block when reallocate() fails") {
+    void* p = arena.allocate(8);
+    REQUIRE(arena.reallocate(p, 300) == nullptr);
+    REQUIRE(arena.overflowed() == true);
+    REQUIRE(arena.reallocate(p, 16) == p);
+  }
+}
+
+TEST_CASE("FixedJsonDocument") {
+  SECTION("deserializes in the inline buffer") {
+    FixedJsonDocument<8192> doc;
+    DeserializationError err =
+        deserializeJson(doc, "{\"sensor\":\"gps\",\"data\":[48.75,2.30]}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["sensor"] == "gps");
+    REQUIRE(doc["data"][1] == 2.30);
+    REQUIRE(doc.overflowed() == false);
+    REQUIRE(doc.arena().size() > 0);
+  }
+
+  SECTION("reports overflow") {
+    FixedJsonDocument<64> doc;
+    DeserializationError err =
+        deserializeJson(doc, "[\"a very long string that doesn't fit\"]");
+
+    REQUIRE(err == DeserializationError::NoMemory);
+    REQUIRE(doc.arena().overflowed() == true);
+  }
+
+  SECTION("reuses the buffer after clear()") {
+    FixedJsonDocument<8192> doc;
+    for (int i = 0; i < 10; i++) {
+      deserializeJson(doc, "{\"hello\":\"world\",\"answer\":42}");
+      REQUIRE(doc["answer"] == 42);
+    }
+    doc.clear();
+    REQUIRE(doc.arena().size() == 0);
+    REQUIRE(doc.arena().overflowed() == false);
+  }
+
+  SECTION("copies the content, not the allocator") {
+    FixedJsonDocument<8192> doc1;
+    doc1["hello"] = std::string("world");
+
+    FixedJsonDocument<8192> doc2(doc1);
+    doc1.clear();
+    REQUIRE(doc2.as<std::string>() == "{\"hello\":\"world\"}");
+
+    FixedJsonDocument<8192> doc3;
+    doc3 = doc2;
+    doc2.clear();
+    REQUIRE(doc3.as<std::string>() == "{\"hello\":\"world\"}");
+  }
+
+  SECTION("copies a JsonDocument") {
+    JsonDocument src;
+    src["value"] = 42;
+
+    FixedJsonDocument<8192> doc(src);
+    REQUIRE(doc.as<std::string>() == "{\"value\":42}");
+  }
+}
@@ -0,0 +1,73 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Document/compactJsonDocument.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+using namespace ArduinoJson;
+
+static std::string toJson(const JsonDocument& doc) {
+  std::string output;
+  serializeJson(doc, output);
+  return output;
+}
+
+TEST_CASE("compactJsonDocument()") {
+  SECTION("keeps the content") {
+    JsonDocument doc;
+    deserializeJson(doc,
+                    "{\"a\":[1,2,{\"b\":\"c\"}],\"d\":\"hello\",\"e\":null}");
+    doc.remove("d");
+    doc["f"] = std::string("world");
+    doc["a"].remove(0);
+
+    std::string expected = toJson(doc);
+    REQUIRE(compactJsonDocument(doc) == true);
+
+    REQUIRE(toJson(doc) == expected);
+    REQUIRE(doc.overflowed() == false);
+  }
+
+  SECTION("releases the pools emptied by removals") {
+    SpyingAllocator spy;
+    JsonDocument doc(&spy);
+    for (int i = 0; i < 1000; i++)
+      doc.add(i);
+    for (int i = 0; i < 990; i++)
+      doc.remove(0);
+    doc.shrinkToFit();
+    size_t before = spy.allocatedBytes();
+
+    REQUIRE(compactJsonDocument(doc) == true);
+
+    REQUIRE(spy.allocatedBytes() < before);
+    REQUIRE(doc.size() == 10);
+    REQUIRE(doc[0] == 990);
+    REQUIRE(doc[9] == 999);
+  }
+
+  SECTION("keeps the document when out of memory") {
+    KillswitchAllocator killswitch;
+    JsonDocument doc(&killswitch);
+    deserializeJson(doc, "{\"a\":[1,2,3],\"b\":\"hello\"}");
+    killswitch.on();
+
+    REQUIRE(compactJsonDocument(doc) == false);
+
+    REQUIRE(toJson(doc) == "{\"a\":[1,2,3],\"b\":\"hello\"}");
+  }
+
+  SECTION("empty document") {
+    JsonDocument doc;
+
+    REQUIRE(compactJsonDocument(doc) == true);
+
+    REQUIRE(doc.isNull());
+  }
+}
@@ -0,0 +1,225 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Patch/JsonPatch.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+using namespace ArduinoJson;
+
+static bool applyPatch(std::string& target, const char* patch) {
+  JsonDocument doc, patchDoc;
+  deserializeJson(doc, target);
+  deserializeJson(patchDoc, patch);
+  bool result = applyJsonPatch(doc, patchDoc);
+  target = doc.as<std::string>();
+  return result;
+}
+
+static std::string createPatch(const char* from, const char* to) {
+  JsonDocument fromDoc, toDoc, patch;
+  deserializeJson(fromDoc, from);
+  deserializeJson(toDoc, to);
+  REQUIRE(createJsonPatch(patch, fromDoc, toDoc) == true);
+  return patch.as<std::string>();
+}
+
+TEST_CASE("applyJsonPatch()") {
+  // examples from RFC 6902, appendix A
+  SECTION("adds an object member") {
+    std::string doc = "{\"foo\":\"bar\"}";
+    REQUIRE(
+        applyPatch(doc, "[{\"op\":\"add\",\"path\":\"/baz\",\"value\":1}]"));
+    REQUIRE(doc == "{\"foo\":\"bar\",\"baz\":1}");
+  }
+
+  SECTION("inserts an array element") {
+    std::string doc = "{\"foo\":[\"bar\",\"baz\"]}";
+    REQUIRE(applyPatch(
+        doc, "[{\"op\":\"add\",\"path\":\"/foo/1\",\"value\":\"qux\"}]"));
+    REQUIRE(doc == "{\"foo\":[\"bar\",\"qux\",\"baz\"]}");
+  }
+
+  SECTION("appends an array element") {
+    std::string doc = "{\"foo\":[1]}";
+    REQUIRE(applyPatch(doc,
+                       "[{\"op\":\"add\",\"path\":\"/foo/-\",\"value\":2},"
+                       "{\"op\":\"add\",\"path\":\"/foo/2\",\"value\":3}]"));
+    REQUIRE(doc == "{\"foo\":[1,2,3]}");
+  }
+
+  SECTION("removes an object member") {
+    std::string doc = "{\"baz\":\"qux\",\"foo\":\"bar\"}";
+    REQUIRE(applyPatch(doc, "[{\"op\":\"remove\",\"path\":\"/baz\"}]"));
+    REQUIRE(doc == "{\"foo\":\"bar\"}");
+  }
+
+  SECTION("removes an array element") {
+    std::string doc = "{\"foo\":[\"bar\",\"qux\",\"baz\"]}";
+    REQUIRE(applyPatch(doc, "[{\"op\":\"remove\",\"path\":\"/foo/1\"}]"));
+    REQUIRE(doc == "{\"foo\":[\"bar\",\"baz\"]}");
+  }
+
+  SECTION("replaces a value") {
+    std::string doc = "{\"baz\":\"qux\",\"foo\":\"bar\"}";
+    REQUIRE(applyPatch(
+        doc, "[{\"op\":\"replace\",\"path\":\"/baz\",\"value\":\"boo\"}]"));
+    REQUIRE(doc == "{\"baz\":\"boo\",\"foo\":\"bar\"}");
+  }
+
+  SECTION("moves a value") {
+    std::string doc = "{\"foo\":{\"bar\":\"baz\",\"waldo\":\"fred\"},"
+                      "\"qux\":{\"corge\":\"grault\"}}";
+    REQUIRE(applyPatch(doc,
+                       "[{\"op\":\"move\",\"from\":\"/foo/waldo\","
+                       "\"path\":\"/qux/thud\"}]"));
+    REQUIRE(doc == "{\"foo\":{\"bar\":\"baz\"},"
+                   "\"qux\":{\"corge\":\"grault\",\"thud\":\"fred\"}}");
+  }
+
+  SECTION("moves an array element") {
+    std::string doc = "{\"foo\":[\"all\",\"grass\",\"cows\",\"eat\"]}";
+    REQUIRE(applyPatch(
+        doc, "[{\"op\":\"move\",\"from\":\"/foo/1\",\"path\":\"/foo/3\"}]"));
+    REQUIRE(doc == "{\"foo\":[\"all\",\"cows\",\"eat\",\"grass\"]}");
+  }
+
+  SECTION("copies a value") {
+    std::string doc = "{\"a\":{\"b\":[1,2]}}";
+    REQUIRE(applyPatch(
+        doc, "[{\"op\":\"copy\",\"from\":\"/a/b\",\"path\":\"/c\"}]"));
+    REQUIRE(doc == "{\"a\":{\"b\":[1,2]},\"c\":[1,2]}");
+  }
+
+  SECTION("fails to move a value into one of its children") {
+    std::string doc = "{\"a\":{\"b\":1},\"ab\":2}";
+    REQUIRE_FALSE(applyPatch(
+        doc, "[{\"op\":\"move\",\"from\":\"/a\",\"path\":\"/a/c\"}]"));
+    REQUIRE(doc == "{\"a\":{\"b\":1},\"ab\":2}");
+    REQUIRE(applyPatch(
+        doc, "[{\"op\":\"move\",\"from\":\"/a\",\"path\":\"/ab\"}]"));
+    REQUIRE(doc == "{\"ab\":{\"b\":1}}");
+  }
+
+  SECTION("copies with the allocator of the target") {
+    KillswitchAllocator killswitch;
+    JsonDocument doc(&killswitch), patch;
+    deserializeJson(doc, "{\"a\":{\"b\":1}}");
+    deserializeJson(patch,
+                    "[{\"op\":\"copy\",\"from\":\"/a\",\"path\":\"/c\"}]");
+    killswitch.on();
+
+    REQUIRE_FALSE(applyJsonPatch(doc, patch));
+    REQUIRE(doc.as<std::string>() == "{\"a\":{\"b\":1}}");
+  }
+
+  SECTION("test passes") {
+    std::string doc = "{\"baz\":\"qux\",\"foo\":[\"a\",2,\"c\"]}";
+    REQUIRE(applyPatch(doc,
+                       "[{\"op\":\"test\",\"path\":\"/baz\",\"value\":\"qux\"},"
+                       "{\"op\":\"test\",\"path\":\"/foo/1\",\"value\":2}]"));
+  }
+
+  SECTION("test fails and stops the patch") {
+    std::string doc = "{\"baz\":\"qux\"}";
+    REQUIRE_FALSE(applyPatch(
+        doc,
+        "[{\"op\":\"test\",\"path\":\"/baz\",\"value\":\"bar\"},"
+        "{\"op\":\"add\",\"path\":\"/a\",\"value\":1}]"));
+    REQUIRE(doc == "{\"baz\":\"qux\"}");
+  }
+
+  SECTION("test doesn't match a missing member with null") {
+    std::string doc = "{}";
+    REQUIRE_FALSE(applyPatch(
+        doc, "[{\"op\":\"test\",\"path\":\"/a\",\"value\":null}]"));
+  }
+
+  SECTION("decodes ~0 and ~1") {
+    std::string doc = "{\"a/b\":1,\"m~n\":2}";
+    REQUIRE(applyPatch(doc,
+                       "[{\"op\":\"replace\",\"path\":\"/a~1b\",\"value\":3},"
+                       "{\"op\":\"remove\",\"path\":\"/m~0n\"},"
+                       "{\"op\":\"add\",\"path\":\"/c~1d\",\"value\":4}]"));
+    REQUIRE(doc == "{\"a/b\":3,\"c/d\":4}");
+  }
+
+  SECTION("replaces the whole document") {
+    std::string doc = "{\"a\":1}";
+    REQUIRE(
+        applyPatch(doc, "[{\"op\":\"replace\",\"path\":\"\",\"value\":[1]}]"));
+    REQUIRE(doc == "[1]");
+  }
+
+  SECTION("fails on a missing path") {
+    std::string doc = "{\"a\":1}";
+    REQUIRE_FALSE(applyPatch(doc, "[{\"op\":\"remove\",\"path\":\"/b\"}]"));
+    REQUIRE_FALSE(
+        applyPatch(doc, "[{\"op\":\"add\",\"path\":\"/b/c\",\"value\":1}]"));
+    REQUIRE_FALSE(applyPatch(
+        doc, "[{\"op\":\"replace\",\"path\":\"/b\",\"value\":1}]"));
+  }
+
+  SECTION("fails on an index out of bounds") {
+    std::string doc = "[1]";
+    REQUIRE_FALSE(
+        applyPatch(doc, "[{\"op\":\"add\",\"path\":\"/2\",\"value\":1}]"));
+    REQUIRE_FALSE(
+        applyPatch(doc, "[{\"op\":\"add\",\"path\":\"/01\",\"value\":1}]"));
+  }
+
+  SECTION("fails on a malformed patch") {
+    std::string doc = "{}";
+    REQUIRE_FALSE(applyPatch(doc, "{\"op\":\"add\"}"));
+    REQUIRE_FALSE(applyPatch(doc, "[{\"op\":\"add\",\"path\":\"/a\"}]"));
+    REQUIRE_FALSE(
+        applyPatch(doc, "[{\"op\":\"jump\",\"path\":\"/a\",\"value\":1}]"));
+    REQUIRE_FALSE(
+        applyPatch(doc, "[{\"op\":\"add\",\"path\":\"a\",\"value\":1}]"));
+  }
+}
+
+TEST_CASE("createJsonPatch()") {
+  SECTION("replaces a changed value") {
+    REQUIRE(createPatch("{\"on\":\"08:00\",\"off\":\"22:00\"}",
+                        "{\"on\":\"07:30\",\"off\":\"22:00\"}") ==
+            "[{\"op\":\"replace\",\"path\":\"/on\",\"value\":\"07:30\"}]");
+  }
+
+  SECTION("adds and removes members") {
+    REQUIRE(createPatch("{\"a\":1,\"b\":2}", "{\"a\":1,\"c\":3}") ==
+            "[{\"op\":\"remove\",\"path\":\"/b\"},"
+            "{\"op\":\"add\",\"path\":\"/c\",\"value\":3}]");
+  }
+
+  SECTION("compares arrays element by element") {
+    REQUIRE(createPatch("[1,2,3,4]", "[1,5,3]") ==
+            "[{\"op\":\"replace\",\"path\":\"/1\",\"value\":5},"
+            "{\"op\":\"remove\",\"path\":\"/3\"}]");
+    REQUIRE(createPatch("[1]", "[1,2]") ==
+            "[{\"op\":\"add\",\"path\":\"/1\",\"value\":2}]");
+  }
+
+  SECTION("escapes the keys") {
+    REQUIRE(createPatch("{\"a/b\":{\"m~n\":1}}", "{\"a/b\":{\"m~n\":2}}") ==
+            "[{\"op\":\"replace\",\"path\":\"/a~1b/m~0n\",\"value\":2}]");
+  }
+
+  SECTION("empty when nothing changed") {
+    REQUIRE(createPatch("{\"a\":[1,{\"b\":2}]}", "{\"a\":[1,{\"b\":2}]}") ==
+            "[]");
+  }
+
+  SECTION("the patch turns from into to") {
+    const char* from = "{\"a\":{\"b\":1,\"c\":[1,2,3]},\"d\":null,\"e\":true}";
+    const char* to = "{\"a\":{\"b\":2,\"c\":[1]},\"d\":null,\"f\":[{\"g\":1}]}";
+    std::string doc = from;
+    REQUIRE(applyPatch(doc, createPatch(from, to).c_str()));
+    REQUIRE(doc == "{\"a\":{\"b\":2,\"c\":[1]},\"d\":null,\"f\":[{\"g\":1}]}");
+  }
+}
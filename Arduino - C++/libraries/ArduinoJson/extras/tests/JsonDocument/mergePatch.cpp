@@ -0,0 +1,107 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Patch/MergePatch.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+using namespace ArduinoJson;
+
+static std::string applyPatch(const char* target, const char* patch) {
+  JsonDocument doc, patchDoc;
+  deserializeJson(doc, target);
+  deserializeJson(patchDoc, patch);
+  REQUIRE(applyMergePatch(doc, patchDoc) == true);
+  return doc.as<std::string>();
+}
+
+static std::string createPatch(const char* from, const char* to) {
+  JsonDocument fromDoc, toDoc, patch;
+  deserializeJson(fromDoc, from);
+  deserializeJson(toDoc, to);
+  REQUIRE(createMergePatch(patch, fromDoc, toDoc) == true);
+  return patch.as<std::string>();
+}
+
+TEST_CASE("applyMergePatch()") {
+  // examples from RFC 7386, appendix A
+  SECTION("replaces a member") {
+    REQUIRE(applyPatch("{\"a\":\"b\"}", "{\"a\":\"c\"}") == "{\"a\":\"c\"}");
+  }
+
+  SECTION("adds a member") {
+    REQUIRE(applyPatch("{\"a\":\"b\"}", "{\"b\":\"c\"}") ==
+            "{\"a\":\"b\",\"b\":\"c\"}");
+  }
+
+  SECTION("removes a member") {
+    REQUIRE(applyPatch("{\"a\":\"b\",\"b\":\"c\"}", "{\"a\":null}") ==
+            "{\"b\":\"c\"}");
+  }
+
+  SECTION("merges nested objects") {
+    REQUIRE(applyPatch("{\"a\":{\"b\":\"c\",\"d\":1}}",
+                       "{\"a\":{\"b\":\"d\",\"e\":null}}") ==
+            "{\"a\":{\"b\":\"d\",\"d\":1}}");
+  }
+
+  SECTION("replaces arrays") {
+    REQUIRE(applyPatch("{\"a\":[{\"b\":\"c\"}]}", "{\"a\":[1]}") ==
+            "{\"a\":[1]}");
+  }
+
+  SECTION("replaces a non-object with an object") {
+    REQUIRE(applyPatch("[\"a\",\"b\"]", "{\"a\":{\"b\":null}}") ==
+            "{\"a\":{}}");
+    REQUIRE(applyPatch("{\"e\":null}", "{\"a\":1}") ==
+            "{\"e\":null,\"a\":1}");
+  }
+
+  SECTION("a non-object patch replaces the document") {
+    REQUIRE(applyPatch("{\"a\":\"foo\"}", "\"bar\"") == "\"bar\"");
+    REQUIRE(applyPatch("{\"a\":\"foo\"}", "null") == "null");
+  }
+
+  SECTION("returns false on unbound variant") {
+    JsonDocument patch;
+    patch["a"] = 1;
+    REQUIRE(applyMergePatch(JsonVariant(), patch) == false);
+  }
+}
+
+TEST_CASE("createMergePatch()") {
+  SECTION("only includes the changed members") {
+    REQUIRE(createPatch("{\"on\":\"08:00\",\"off\":\"22:00\",\"days\":[1]}",
+                        "{\"on\":\"07:30\",\"off\":\"22:00\",\"days\":[1]}") ==
+            "{\"on\":\"07:30\"}");
+  }
+
+  SECTION("removed members are null") {
+    REQUIRE(createPatch("{\"a\":1,\"b\":2}", "{\"a\":1}") == "{\"b\":null}");
+  }
+
+  SECTION("recurses into nested objects") {
+    REQUIRE(createPatch("{\"a\":{\"b\":1,\"c\":2}}",
+                        "{\"a\":{\"b\":1,\"c\":3}}") == "{\"a\":{\"c\":3}}");
+  }
+
+  SECTION("replaces modified arrays") {
+    REQUIRE(createPatch("{\"a\":[1,2,3]}", "{\"a\":[1,2,4]}") ==
+            "{\"a\":[1,2,4]}");
+  }
+
+  SECTION("empty object when nothing changed") {
+    REQUIRE(createPatch("{\"a\":[1,{\"b\":2}]}", "{\"a\":[1,{\"b\":2}]}") ==
+            "{}");
+  }
+
+  SECTION("the patch turns from into to") {
+    const char* from = "{\"a\":{\"b\":1,\"c\":[1]},\"d\":\"x\",\"e\":true}";
+    const char* to = "{\"a\":{\"b\":2,\"c\":[1]},\"d\":\"x\",\"f\":{\"g\":1}}";
+    REQUIRE(applyPatch(from, createPatch(from, to).c_str()) ==
+            "{\"a\":{\"b\":2,\"c\":[1]},\"d\":\"x\",\"f\":{\"g\":1}}");
+  }
+}
@@ -0,0 +1,109 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ArduinoJson/Serialization/BufferedPrint.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+using namespace ArduinoJson;
+
+// Records the calls, and accepts at most `limit` bytes
+class SpyingPrint : public Print {
+ public:
+  size_t write(uint8_t c) override {
+    return write(&c, 1);
+  }
+
+  size_t write(const uint8_t* s, size_t n) override {
+    calls++;
+    if (n > limit - output.size())
+      n = limit - output.size();
+    output.append(reinterpret_cast<const char*>(s), n);
+    return n;
+  }
+
+  using Print::write;
+
+  std::string output;
+  size_t calls = 0;
+  size_t limit = size_t(-1);
+};
+
+TEST_CASE("BufferedPrint") {
+  SpyingPrint target;
+
+  SECTION("forwards the output in chunks") {
+    JsonDocument doc;
+    for (int i = 0; i < 100; i++)
+      doc.add(i);
+
+    std::string expected;
+    serializeJson(doc, expected);
+
+    size_t n;
+    {
+      BufferedPrint<64> buffered(target);
+      n = serializeJson(doc, buffered);
+    }
+
+    REQUIRE(target.output == expected);
+    REQUIRE(n == expected.size());
+    REQUIRE(target.calls == (expected.size() + 63) / 64);
+  }
+
+  SECTION("keeps the bytes until flush()") {
+    BufferedPrint<16> buffered(target);
+    buffered.write(reinterpret_cast<const uint8_t*>("hello"), 5);
+    buffered.write('!');
+
+    REQUIRE(target.output == "");
+    buffered.flush();
+    REQUIRE(target.output == "hello!");
+    REQUIRE(target.calls == 1);
+  }
+
+  SECTION("forwards large blocks directly") {
+    BufferedPrint<4> buffered(target);
+    buffered.write(reinterpret_cast<const uint8_t*>("123456"), 6);
+    REQUIRE(target.output == "123456");
+
+    buffered.write('[');
+    buffered.write(reinterpret_cast<const uint8_t*>("abcdefgh"), 8);
+    REQUIRE(target.output == "123456[abcdefgh");
+    REQUIRE(target.calls == 3);
+  }
+
+  SECTION("stops when the target is full") {
+    target.limit = 10;
+    BufferedPrint<8> buffered(target);
+
+    size_t n = 0;
+    for (int i = 0; i < 20; i++)
+      n += buffered.write('x');
+    buffered.flush();
+
+    REQUIRE(buffered.failed() == true);
+    REQUIRE(target.output == "xxxxxxxxxx");
+    REQUIRE(n < 20);
+  }
+
+  SECTION("works with serializeMsgPack()") {
+    JsonDocument doc;
+    doc["hello"] = "world";
+
+    std::string expected;
+    serializeMsgPack(doc, expected);
+
+    {
+      BufferedPrint<64> buffered(target);
+      serializeMsgPack(doc, buffered);
+    }
+
+    REQUIRE(target.output == expected);
+    REQUIRE(target.calls == 1);
+  }
+}
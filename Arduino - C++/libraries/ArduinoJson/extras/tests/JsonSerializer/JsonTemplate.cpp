@@ -0,0 +1,112 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Json/JsonTemplate.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+using namespace ArduinoJson;
+
+TEST_CASE("JsonTemplate") {
+  std::string output;
+
+  SECTION("replaces the placeholders with the values") {
+    JsonTemplate<3> tpl("{\"temp\":?,\"hum\":?,\"tags\":[\"a\",?]}");
+
+    REQUIRE(tpl.valid() == true);
+    REQUIRE(tpl.placeholders() == 3);
+    size_t n = tpl.serialize(output, 21.5, 40, "b");
+
+    REQUIRE(output == "{\"temp\":21.5,\"hum\":40,\"tags\":[\"a\",\"b\"]}");
+    REQUIRE(n == output.size());
+  }
+
+  SECTION("can be used many times") {
+    JsonTemplate<1> tpl("{\"id\":?}");
+
+    tpl.serialize(output, 1);
+    tpl.serialize(output, 2);
+
+    REQUIRE(output == "{\"id\":1}{\"id\":2}");
+  }
+
+  SECTION("escapes strings") {
+    JsonTemplate<1> tpl("[?]");
+
+    tpl.serialize(output, "say \"hi\"\n");
+
+    REQUIRE(output == "[\"say \\\"hi\\\"\\n\"]");
+  }
+
+  SECTION("formats bool, null, and negative numbers") {
+    JsonTemplate<3> tpl("[?,?,?]");
+
+    tpl.serialize(output, true, nullptr, -12);
+
+    REQUIRE(output == "[true,null,-12]");
+  }
+
+  SECTION("ignores question marks in strings") {
+    JsonTemplate<1> tpl("{\"what?\":?,'why?':\"\\\"?\"}");
+
+    REQUIRE(tpl.placeholders() == 1);
+    tpl.serialize(output, 0);
+
+    REQUIRE(output == "{\"what?\":0,'why?':\"\\\"?\"}");
+  }
+
+  SECTION("placeholder at the root") {
+    JsonTemplate<1> tpl("?");
+
+    tpl.serialize(output, 42);
+
+    REQUIRE(output == "42");
+  }
+
+  SECTION("writes nothing if the number of values is wrong") {
+    JsonTemplate<2> tpl("[?,?]");
+
+    REQUIRE(tpl.serialize(output, 1) == 0);
+    REQUIRE(tpl.serialize(output, 1, 2, 3) == 0);
+    REQUIRE(output == "");
+  }
+
+  SECTION("invalid with too many placeholders") {
+    JsonTemplate<1> tpl("[?,?]");
+
+    REQUIRE(tpl.valid() == false);
+    REQUIRE(tpl.placeholders() == 2);
+    REQUIRE(tpl.serialize(output, 1) == 0);
+  }
+
+  SECTION("invalid with a null text") {
+    JsonTemplate<1> tpl(nullptr);
+
+    REQUIRE(tpl.valid() == false);
+  }
+}
+
+TEST_CASE("JsonTemplate::serialize(char*, size_t)") {
+  JsonTemplate<1> tpl("{\"a\":?}");
+
+  SECTION("adds a terminator") {
+    char buffer[16];
+
+    size_t n = tpl.serialize(buffer, sizeof(buffer), 123);
+
+    REQUIRE(n == 9);
+    REQUIRE(buffer == std::string("{\"a\":123}"));
+  }
+
+  SECTION("truncates") {
+    char buffer[6] = "xxxxx";
+
+    size_t n = tpl.serialize(buffer, sizeof(buffer), 123);
+
+    REQUIRE(n == 6);
+    REQUIRE(std::string(buffer, 6) == "{\"a\":1");
+  }
+}
@@ -0,0 +1,187 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Json/JsonWriter.hpp>
+#include <catch.hpp>
+
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace ArduinoJson;
+
+TEST_CASE("JsonWriter") {
+  std::string output;
+  auto writer = makeJsonWriter(output);
+
+  SECTION("object") {
+    REQUIRE(writer.beginObject());
+    REQUIRE(writer.key("hello"));
+    REQUIRE(writer.value("world"));
+    REQUIRE(writer.key(std::string("answer")));
+    REQUIRE(writer.value(42));
+    REQUIRE(writer.endObject());
+
+    REQUIRE(output == "{\"hello\":\"world\",\"answer\":42}");
+    REQUIRE(writer.done() == true);
+    REQUIRE(writer.bytesWritten() == output.size());
+  }
+
+  SECTION("nested containers") {
+    writer.beginArray();
+    writer.beginObject();
+    writer.key("a");
+    writer.beginArray();
+    writer.endArray();
+    writer.endObject();
+    writer.beginObject();
+    writer.endObject();
+    REQUIRE(writer.depth() == 1);
+    REQUIRE(writer.done() == false);
+    writer.endArray();
+
+    REQUIRE(output == "[{\"a\":[]},{}]");
+    REQUIRE(writer.done() == true);
+  }
+
+  SECTION("scalars") {
+    writer.beginArray();
+    writer.value(true);
+    writer.value(false);
+    writer.value(nullptr);
+    writer.value(-42);
+    writer.value(std::numeric_limits<int64_t>::min());
+    writer.value(std::numeric_limits<uint64_t>::max());
+    writer.value(3.14);
+    writer.value(0.5f);
+    writer.value(static_cast<const char*>(nullptr));
+    writer.endArray();
+
+    REQUIRE(output ==
+            "[true,false,null,-42,-9223372036854775808,"
+            "18446744073709551615,3.14,0.5,null]");
+  }
+
+  SECTION("formats numbers like serializeJson()") {
+    double doubles[] = {3.14, 1e20, -1e-7, 123456789.123, 1.0 / 3, 1e300};
+    float floats[] = {3.14f, 1e20f, -1e-7f, 123456.7f, 1.0f / 3};
+    JsonDocument doc;
+    writer.beginArray();
+    for (double d : doubles) {
+      writer.value(d);
+      doc.add(d);
+    }
+    for (float f : floats) {
+      writer.value(f);
+      doc.add(f);
+    }
+    writer.endArray();
+
+    REQUIRE(output == doc.as<std::string>());
+  }
+
+  SECTION("escapes strings like serializeJson()") {
+    const char* s = "\"\\\b\f\n\r\t\x01/é";
+    writer.value(s);
+
+    JsonDocument doc;
+    doc.set(s);
+    REQUIRE(output == doc.as<std::string>());
+  }
+
+  SECTION("long strings") {
+    std::string s(100, 'a');
+    s[31] = '\n';
+    writer.value(s);
+
+    REQUIRE(output == "\"" + s.substr(0, 31) + "\\n" + s.substr(32) + "\"");
+  }
+
+  SECTION("writes a variant") {
+    JsonDocument doc;
+    deserializeJson(doc, "{\"a\":[1,2.5,\"x\",null,true],\"b\":{\"c\":{}}}");
+
+    writer.beginArray();
+    writer.value(doc);
+    writer.value(doc["a"][1]);
+    writer.endArray();
+
+    REQUIRE(output ==
+            "[{\"a\":[1,2.5,\"x\",null,true],\"b\":{\"c\":{}}},2.5]");
+  }
+
+  SECTION("writes serialized() values verbatim") {
+    JsonDocument doc;
+    doc["a"] = serialized("[1, 2]");
+    doc["b"] = serialized(std::string("1.50"));
+
+    writer.value(doc);
+
+    REQUIRE(output == "{\"a\":[1, 2],\"b\":1.50}");
+    REQUIRE(writer.bytesWritten() == output.size());
+  }
+
+  SECTION("rejects a value without a key") {
+    writer.beginObject();
+    REQUIRE(writer.value(1) == false);
+    REQUIRE(writer.failed() == true);
+    REQUIRE(writer.key("a") == false);  // all following calls fail
+  }
+
+  SECTION("rejects a key in an array") {
+    writer.beginArray();
+    REQUIRE(writer.key("a") == false);
+  }
+
+  SECTION("rejects a mismatched end") {
+    writer.beginArray();
+    REQUIRE(writer.endObject() == false);
+  }
+
+  SECTION("rejects an end after a key") {
+    writer.beginObject();
+    writer.key("a");
+    REQUIRE(writer.endObject() == false);
+  }
+
+  SECTION("rejects a second root") {
+    writer.value(1);
+    REQUIRE(writer.value(2) == false);
+    REQUIRE(output == "1");
+  }
+
+  SECTION("limits the depth to 64") {
+    for (int i = 0; i < 64; i++)
+      REQUIRE(writer.beginArray());
+    REQUIRE(writer.beginArray() == false);
+  }
+}
+
+TEST_CASE("makePrettyJsonWriter()") {
+  JsonDocument doc;
+  deserializeJson(doc,
+                  "{\"a\":1,\"b\":[1,\"s\",{},[]],"
+                  "\"c\":{\"d\":[{\"e\":null}]}}");
+  std::string expected;
+  serializeJsonPretty(doc, expected);
+
+  std::string output;
+  auto writer = makePrettyJsonWriter(output);
+  REQUIRE(writer.value(doc));
+
+  REQUIRE(output == expected);
+}
+
+TEST_CASE("JsonWriter writes to a stream") {
+  std::ostringstream stream;
+  auto writer = makeJsonWriter(stream);
+
+  writer.beginObject();
+  writer.key("a");
+  writer.value(1);
+  writer.endObject();
+
+  REQUIRE(stream.str() == "{\"a\":1}");
+}
@@ -0,0 +1,121 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Variant/hashJson.hpp>
+#include <catch.hpp>
+
+#include "Allocators.hpp"
+
+using namespace ArduinoJson;
+using DeserializationOption::Filter;
+using HashOption::IgnoreKeyOrder;
+
+static uint64_t hashOf(const char* json) {
+  JsonDocument doc;
+  deserializeJson(doc, json);
+  return hashJson(doc);
+}
+
+TEST_CASE("hashJson()") {
+  SECTION("equal documents have equal hashes") {
+    REQUIRE(hashOf("{\"a\":[1,2,{\"b\":null}]}") ==
+            hashOf("{\"a\":[1,2,{\"b\":null}]}"));
+  }
+
+  SECTION("distinguishes the types") {
+    REQUIRE(hashOf("null") != hashOf("false"));
+    REQUIRE(hashOf("1") != hashOf("\"1\""));
+    REQUIRE(hashOf("1") != hashOf("true"));
+    REQUIRE(hashOf("[]") != hashOf("{}"));
+    REQUIRE(hashOf("[]") != hashOf("null"));
+  }
+
+  SECTION("distinguishes the structure") {
+    REQUIRE(hashOf("[[1],2]") != hashOf("[[1,2]]"));
+    REQUIRE(hashOf("[1,2]") != hashOf("[2,1]"));
+    REQUIRE(hashOf("{\"ab\":\"c\"}") != hashOf("{\"a\":\"bc\"}"));
+  }
+
+  SECTION("integral floats hash like integers") {
+    REQUIRE(hashOf("1.0") == hashOf("1"));
+    REQUIRE(hashOf("-0.0") == hashOf("0"));
+    REQUIRE(hashOf("1.5") != hashOf("1"));
+  }
+
+  SECTION("hashes the text of serialized() values") {
+    JsonDocument doc1, doc2;
+    doc1["a"] = serialized("1.10");
+    doc2["a"] = serialized("1.20");
+    REQUIRE(hashJson(doc1) != hashJson(doc2));
+
+    doc2["a"] = serialized("1.10");
+    REQUIRE(hashJson(doc1) == hashJson(doc2));
+
+    doc2["a"] = "1.10";
+    REQUIRE(hashJson(doc1) != hashJson(doc2));
+  }
+
+  SECTION("key order matters by default") {
+    REQUIRE(hashOf("{\"a\":1,\"b\":2}") != hashOf("{\"b\":2,\"a\":1}"));
+  }
+
+  SECTION("IgnoreKeyOrder") {
+    JsonDocument doc1, doc2;
+    deserializeJson(doc1, "{\"a\":1,\"b\":{\"c\":2,\"d\":3}}");
+    deserializeJson(doc2, "{\"b\":{\"d\":3,\"c\":2},\"a\":1}");
+
+    REQUIRE(hashJson(doc1, 0, IgnoreKeyOrder()) ==
+            hashJson(doc2, 0, IgnoreKeyOrder()));
+    REQUIRE(hashJson(doc1, 0, IgnoreKeyOrder()) != hashJson(doc1));
+  }
+
+  SECTION("the seed changes the hash") {
+    JsonDocument doc;
+    doc["a"] = 1;
+
+    REQUIRE(hashJson(doc, 1) != hashJson(doc, 2));
+    REQUIRE(hashJson(doc, 1) == hashJson(doc, 1));
+  }
+
+  SECTION("Filter skips the rejected members") {
+    JsonDocument filter;
+    filter["*"] = true;
+    filter["timestamp"] = false;
+    JsonDocument doc1, doc2;
+    deserializeJson(doc1, "{\"value\":42,\"timestamp\":1000}");
+    deserializeJson(doc2, "{\"value\":42,\"timestamp\":2000}");
+
+    REQUIRE(hashJson(doc1) != hashJson(doc2));
+    REQUIRE(hashJson(doc1, 0, Filter(filter)) ==
+            hashJson(doc2, 0, Filter(filter)));
+    REQUIRE(hashJson(doc1, 0, Filter(filter), IgnoreKeyOrder()) ==
+            hashJson(doc2, 0, IgnoreKeyOrder(), Filter(filter)));
+  }
+
+  SECTION("Filter applies to array elements") {
+    JsonDocument filter;
+    filter[0]["id"] = true;
+    JsonDocument doc1, doc2;
+    deserializeJson(doc1, "[{\"id\":1,\"rssi\":-40},{\"id\":2,\"rssi\":-70}]");
+    deserializeJson(doc2, "[{\"id\":1,\"rssi\":-45},{\"id\":2,\"rssi\":-75}]");
+
+    REQUIRE(hashJson(doc1, 0, Filter(filter)) ==
+            hashJson(doc2, 0, Filter(filter)));
+  }
+
+  SECTION("doesn't allocate") {
+    SpyingAllocator spy;
+    JsonDocument doc(&spy);
+    deserializeJson(doc, "{\"a\":[1,2,{\"b\":\"hello\"}],\"c\":3.14}");
+    JsonDocument filter;
+    filter["a"] = true;
+    spy.clearLog();
+
+    hashJson(doc);
+    hashJson(doc, 42, IgnoreKeyOrder(), Filter(filter));
+
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+}
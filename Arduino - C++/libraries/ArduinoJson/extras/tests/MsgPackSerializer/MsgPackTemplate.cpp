@@ -0,0 +1,174 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/MsgPack/MsgPackTemplate.hpp>
+#include <catch.hpp>
+
+#include <limits>
+#include <string>
+
+using namespace ArduinoJson;
+
+TEST_CASE("MsgPackTemplate") {
+  std::string output;
+
+  SECTION("replaces the placeholders with the values") {
+    MsgPackTemplate<3, 32> tpl("{\"temp\":?,\"hum\":?,\"tags\":[\"a\",?]}");
+
+    REQUIRE(tpl.valid() == true);
+    REQUIRE(tpl.placeholders() == 3);
+    size_t n = tpl.serialize(output, 21.5, 40, "b");
+
+    REQUIRE(output == std::string("\x83\xA4temp\xCA\x41\xAC\x00\x00\xA3hum"
+                                  "\x28\xA4tags\x92\xA1"
+                                  "a\xA1"
+                                  "b",
+                                  26));
+    REQUIRE(n == output.size());
+  }
+
+  SECTION("can be used many times") {
+    MsgPackTemplate<1, 8> tpl("{\"id\":?}");
+
+    tpl.serialize(output, 1);
+    tpl.serialize(output, 2);
+
+    REQUIRE(output == "\x81\xA2id\x01\x81\xA2id\x02");
+  }
+
+  SECTION("encodes the values like serializeMsgPack()") {
+    MsgPackTemplate<1, 8> tpl("?");
+    JsonDocument doc;
+    const char* json[] = {
+        "0",     "127",  "128",        "-32",   "-33",  "-129", "65536",
+        "-1e3",  "1.5",  "3.14",       "true",  "null", "\"\"", "\"abc\"",
+        "-1e30", "4294967296", "-2147483649", "18446744073709551615",
+    };
+
+    for (const char* value : json) {
+      deserializeJson(doc, value);
+      std::string expected;
+      serializeMsgPack(doc, expected);
+
+      output.clear();
+      tpl.serialize(output, doc.as<JsonVariantConst>());
+      REQUIRE(output == expected);
+
+      MsgPackTemplate<1, 16> constant(value);
+      output.clear();
+      REQUIRE(constant.placeholders() == 0);
+      constant.serialize(output);
+      REQUIRE(output == expected);
+    }
+  }
+
+  SECTION("encodes integers in the smallest format") {
+    MsgPackTemplate<6, 8> tpl("[?,?,?,?,?,?]");
+
+    tpl.serialize(output, 127, 255, -32, -128, 65535, -32768);
+
+    REQUIRE(output == std::string("\x96\x7F\xCC\xFF\xE0\xD0\x80\xCD\xFF\xFF"
+                                  "\xD1\x80\x00",
+                                  13));
+  }
+
+  SECTION("encodes bool, null, and doubles") {
+    MsgPackTemplate<4, 8> tpl("[?,?,?,?]");
+
+    tpl.serialize(output, true, nullptr, 0.5, 0.1);
+
+    REQUIRE(output ==
+            std::string("\x94\xC3\xC0\xCA\x3F\x00\x00\x00"
+                        "\xCB\x3F\xB9\x99\x99\x99\x99\x99\x9A",
+                        17));
+  }
+
+  SECTION("encodes NaN as a float64, like serializeMsgPack()") {
+    MsgPackTemplate<1, 8> tpl("?");
+
+    tpl.serialize(output, std::numeric_limits<double>::quiet_NaN());
+
+    REQUIRE(output ==
+            std::string("\xCB\x7F\xF8\x00\x00\x00\x00\x00\x00", 9));
+  }
+
+  SECTION("writes long strings as is") {
+    MsgPackTemplate<1, 8> tpl("?");
+    std::string s(40, 'x');
+
+    size_t n = tpl.serialize(output, s);
+
+    REQUIRE(output == "\xD9\x28" + s);
+    REQUIRE(n == 42);
+  }
+
+  SECTION("decodes the escape sequences of the constant strings") {
+    MsgPackTemplate<1, 32> tpl("{'k\\u00e9\\\"y':\"\\ud83d\\ude00\\n\"}");
+
+    REQUIRE(tpl.valid() == true);
+    tpl.serialize(output);
+
+    REQUIRE(output == "\x81\xA5k\xC3\xA9\"y\xA5\xF0\x9F\x98\x80\n");
+  }
+
+  SECTION("ignores question marks in strings") {
+    MsgPackTemplate<1, 16> tpl("{\"what?\":?}");
+
+    REQUIRE(tpl.placeholders() == 1);
+    tpl.serialize(output, 0);
+
+    REQUIRE(output == std::string("\x81\xA5what?\x00", 8));
+  }
+
+  SECTION("writes nothing if the number of values is wrong") {
+    MsgPackTemplate<2, 8> tpl("[?,?]");
+
+    REQUIRE(tpl.serialize(output, 1) == 0);
+    REQUIRE(tpl.serialize(output, 1, 2, 3) == 0);
+    REQUIRE(output == "");
+  }
+
+  SECTION("invalid with too many placeholders") {
+    MsgPackTemplate<1, 8> tpl("[?,?]");
+
+    REQUIRE(tpl.valid() == false);
+    REQUIRE(tpl.serialize(output, 1) == 0);
+  }
+
+  SECTION("invalid if the constant parts don't fit") {
+    MsgPackTemplate<1, 8> tpl("{\"temperature\":?}");
+
+    REQUIRE(tpl.valid() == false);
+  }
+
+  SECTION("invalid JSON") {
+    REQUIRE(MsgPackTemplate<1, 8>(nullptr).valid() == false);
+    REQUIRE(MsgPackTemplate<1, 8>("[?,]").valid() == false);
+    REQUIRE(MsgPackTemplate<1, 8>("{?:1}").valid() == false);
+    REQUIRE(MsgPackTemplate<1, 8>("[1 2]").valid() == false);
+    REQUIRE(MsgPackTemplate<1, 8>("[\"a]").valid() == false);
+    REQUIRE(MsgPackTemplate<1, 8>("[?] ?").valid() == false);
+    REQUIRE(MsgPackTemplate<1, 8>("nul").valid() == false);
+  }
+}
+
+TEST_CASE("MsgPackTemplate::serialize(void*, size_t)") {
+  MsgPackTemplate<1, 8> tpl("[?]");
+  char buffer[8] = "xxxxxxx";
+
+  SECTION("doesn't add a terminator") {
+    size_t n = tpl.serialize(buffer, sizeof(buffer), 1);
+
+    REQUIRE(n == 2);
+    REQUIRE(std::string(buffer, 3) == "\x91\x01x");
+  }
+
+  SECTION("truncates") {
+    size_t n = tpl.serialize(buffer, 2, "abc");
+
+    REQUIRE(n == 2);
+    REQUIRE(std::string(buffer, 3) == "\x91\xA3x");
+  }
+}
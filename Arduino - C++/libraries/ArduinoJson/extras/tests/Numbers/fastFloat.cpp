@@ -0,0 +1,127 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Numbers/parseFloatFast.hpp>
+#include <catch.hpp>
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+using namespace ArduinoJson::detail;
+
+template <typename T>
+static T parse(const std::string& s) {
+  T result = 0;
+  const char* end = parseFloatFast(s.data(), s.data() + s.size(), result);
+  REQUIRE(end == s.data() + s.size());
+  return result;
+}
+
+template <typename T>
+static T fromBits(uint64_t bits) {
+  T value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static uint64_t nextRandom(uint64_t& state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+TEST_CASE("parseFloatFast<double>()") {
+  SECTION("simple values") {
+    REQUIRE(parse<double>("0") == 0.0);
+    REQUIRE(parse<double>("1") == 1.0);
+    REQUIRE(parse<double>("-2.5") == -2.5);
+    REQUIRE(parse<double>("3.14") == 3.14);
+    REQUIRE(parse<double>("0.000123") == 0.000123);
+    REQUIRE(parse<double>("1E3") == 1000.0);
+    REQUIRE(parse<double>("1e+3") == 1000.0);
+  }
+
+  SECTION("negative zero") {
+    double d = parse<double>("-0");
+    REQUIRE(d == 0.0);
+    REQUIRE(signbit(d));
+  }
+
+  SECTION("limits") {
+    REQUIRE(parse<double>("1.7976931348623157e308") == DBL_MAX);
+    REQUIRE(parse<double>("2.2250738585072014e-308") == DBL_MIN);
+    REQUIRE(parse<double>("4.9406564584124654e-324") == fromBits<double>(1));
+    REQUIRE(parse<double>("2e-324") == 0.0);
+    REQUIRE(parse<double>("1e309") == HUGE_VAL);
+    REQUIRE(parse<double>("1e100000000") == HUGE_VAL);
+    REQUIRE(parse<double>("1e-100000000") == 0.0);
+  }
+
+  SECTION("rounds ties to even") {
+    REQUIRE(parse<double>("9007199254740993") == 9007199254740992.0);
+    REQUIRE(parse<double>("9007199254740995") == 9007199254740996.0);
+  }
+
+  SECTION("more than 19 significant digits") {
+    REQUIRE(parse<double>("3.14159265358979323846264338327950288") ==
+            3.141592653589793);
+    REQUIRE(parse<double>("100000000000000000000000") == 1e23);
+    REQUIRE(parse<double>("0.0000000000000000000000000001234567890123456789"
+                          "012345") == 1.234567890123456789012345e-28);
+  }
+
+  SECTION("rejects invalid input") {
+    const char* inputs[] = {"", "-", ".", "1e", "1e+", "abc", "-e3"};
+    for (const char* input : inputs) {
+      double d;
+      CAPTURE(input);
+      REQUIRE(parseFloatFast(input, input + strlen(input), d) == nullptr);
+    }
+  }
+
+  SECTION("stops at the end of the number") {
+    const char* input = "12.5,\"next\"";
+    double d;
+    REQUIRE(parseFloatFast(input, input + strlen(input), d) == input + 4);
+    REQUIRE(d == 12.5);
+  }
+
+  SECTION("matches strtod()") {
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 100000; i++) {
+      char input[48];
+      uint64_t mantissa = nextRandom(state) % 100000000000000000ULL;
+      int exponent = int(nextRandom(state) % 660) - 340;
+      snprintf(input, sizeof(input), "%llue%d",
+               static_cast<unsigned long long>(mantissa), exponent);
+      CAPTURE(input);
+      REQUIRE(parse<double>(input) == strtod(input, nullptr));
+    }
+  }
+}
+
+TEST_CASE("parseFloatFast<float>()") {
+  REQUIRE(parse<float>("3.14") == 3.14f);
+  REQUIRE(parse<float>("3.4028235e38") == FLT_MAX);
+  REQUIRE(parse<float>("1.17549435e-38") == FLT_MIN);
+  REQUIRE(parse<float>("1e-45") == fromBits<float>(1));
+  REQUIRE(parse<float>("1e39") == HUGE_VALF);
+
+  uint64_t state = 0x2545F4914F6CDD1DULL;
+  for (int i = 0; i < 100000; i++) {
+    char input[48];
+    uint64_t mantissa = nextRandom(state) % 1000000000000ULL;
+    int exponent = int(nextRandom(state) % 100) - 60;
+    snprintf(input, sizeof(input), "%llue%d",
+             static_cast<unsigned long long>(mantissa), exponent);
+    CAPTURE(input);
+    REQUIRE(parse<float>(input) == strtof(input, nullptr));
+  }
+}
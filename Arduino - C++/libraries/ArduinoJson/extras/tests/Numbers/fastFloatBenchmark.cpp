@@ -0,0 +1,58 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <ArduinoJson/Numbers/parseFloatFast.hpp>
+#include <catch.hpp>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+using namespace ArduinoJson::detail;
+
+// Hidden test: run with NumbersTests "[.benchmark]"
+TEST_CASE("fast float benchmark", "[.benchmark]") {
+  typedef std::chrono::steady_clock clock;
+
+  // Sensor-like values, as printed by %.17g
+  std::vector<std::string> texts;
+  uint64_t state = 88172645463325252ULL;
+  for (int i = 0; i < 10000; i++) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    double value = double(state % 2000000) / 1000.0 - 1000.0;
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.17g", value);
+    texts.push_back(buffer);
+  }
+  const int rounds = 50;
+  volatile double sink = 0;
+
+  clock::time_point t0 = clock::now();
+  for (int r = 0; r < rounds; r++)
+    for (const std::string& s : texts)
+      sink = sink + strtod(s.c_str(), nullptr);
+  clock::time_point t1 = clock::now();
+  for (int r = 0; r < rounds; r++)
+    for (const std::string& s : texts) {
+      double d = 0;
+      parseFloatFast(s.data(), s.data() + s.size(), d);
+      sink = sink + d;
+    }
+  clock::time_point t2 = clock::now();
+
+  auto ns = [&](clock::time_point a, clock::time_point b) {
+    return double(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a)
+                      .count()) /
+           (rounds * double(texts.size()));
+  };
+  printf("parse: strtod %.1f ns, Eisel-Lemire %.1f ns\n", ns(t0, t1),
+         ns(t1, t2));
+
+  REQUIRE(sink != 0);
+}
@@ -0,0 +1,80 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Reads a Stream in chunks of up to Capacity bytes.
+// Reading a Stream directly costs a call to readBytes(), and a trip through
+// the timeout loop, for every byte. This reader pulls whatever available()
+// reports in a single readBytes(), and only waits (with the stream's
+// timeout) when nothing is available.
+//
+//   BufferedStreamReader<64> reader(client);
+//   deserializeJson(doc, reader);
+//
+// It reads ahead, so it may consume bytes past the end of the document; read
+// them from this object, not from the stream.
+template <size_t Capacity = 64>
+class BufferedStreamReader {
+  static_assert(Capacity > 0, "Capacity must be positive");
+
+ public:
+  explicit BufferedStreamReader(Stream& stream)
+      : stream_(&stream), begin_(0), end_(0) {}
+
+  BufferedStreamReader(const BufferedStreamReader&) = delete;
+  BufferedStreamReader& operator=(const BufferedStreamReader&) = delete;
+
+  int read() {
+    if (begin_ == end_ && !fill())
+      return -1;
+    return static_cast<unsigned char>(buffer_[begin_++]);
+  }
+
+  int peek() {
+    if (begin_ == end_ && !fill())
+      return -1;
+    return static_cast<unsigned char>(buffer_[begin_]);
+  }
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t n = end_ - begin_;
+    if (n > length)
+      n = length;
+    memcpy(buffer, buffer_ + begin_, n);
+    begin_ += n;
+    if (n < length)  // large reads go straight to the stream
+      n += stream_->readBytes(buffer + n, length - n);
+    return n;
+  }
+
+  // Bytes that can be read without waiting
+  int available() {
+    return static_cast<int>(end_ - begin_) + stream_->available();
+  }
+
+ private:
+  bool fill() {
+    int available = stream_->available();
+    size_t n = available > 0 ? static_cast<size_t>(available) : 1;
+    if (n > Capacity)
+      n = Capacity;
+    begin_ = 0;
+    end_ = stream_->readBytes(buffer_, n);
+    return end_ > 0;
+  }
+
+  Stream* stream_;
+  char buffer_[Capacity];
+  size_t begin_;
+  size_t end_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,253 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/DeserializationOptions.hpp>
+#include <ArduinoJson/Object/JsonObjectConst.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+#include <ArduinoJson/Strings/StringHash.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// One state of a compiled filter: what to keep for a value, and, for objects
+// and arrays, the contiguous range of child states
+struct FilterState {
+  enum Kind : uint8_t {
+    Reject,    // false, 0...
+    Null,      // like Reject, but lets the wildcard apply
+    KeepNull,  // other truthy scalars: keep the member, drop the value
+    AllowAll,  // true
+    Object,
+    Array,
+  };
+
+  static constexpr uint16_t none = 0xFFFF;
+
+  const char* key;  // points into the filter document
+  uint32_t hash;
+  uint16_t keyLength;
+  uint16_t firstChild;
+  uint16_t childCount;
+  uint16_t wildcard;
+  Kind kind;
+};
+
+// The filter passed to the deserializer: a position in the state table.
+// Copied at each level, so it's only two words; a null table means "reject".
+class CompiledFilterRef {
+ public:
+  CompiledFilterRef() : states_(nullptr), index_(0) {}
+
+  CompiledFilterRef(const FilterState* states, uint16_t index)
+      : states_(states), index_(index) {}
+
+  bool allow() const {
+    return kind() != FilterState::Reject && kind() != FilterState::Null;
+  }
+
+  bool allowArray() const {
+    return kind() == FilterState::AllowAll || kind() == FilterState::Array;
+  }
+
+  bool allowObject() const {
+    return kind() == FilterState::AllowAll || kind() == FilterState::Object;
+  }
+
+  bool allowValue() const {
+    return kind() == FilterState::AllowAll;
+  }
+
+  // Array element (the deserializer passes 0)
+  template <typename TIndex>
+  enable_if_t<is_integral<TIndex>::value, CompiledFilterRef> operator[](
+      TIndex) const {
+    switch (kind()) {
+      case FilterState::AllowAll:
+        return *this;
+      case FilterState::Array:
+        return child(state().firstChild);
+      case FilterState::Object:
+        return child(state().wildcard);
+      default:
+        return CompiledFilterRef();
+    }
+  }
+
+  // Object member: first matching key, or "*", like Filter
+  template <typename TKey>
+  enable_if_t<!is_integral<TKey>::value, CompiledFilterRef> operator[](
+      const TKey& key) const {
+    if (kind() == FilterState::AllowAll)
+      return *this;
+    if (kind() != FilterState::Object)
+      return CompiledFilterRef();
+    auto str = adaptString(key);
+    uint32_t hash = hashKey(str);
+    const FilterState& parent = state();
+    for (uint16_t i = 0; i < parent.childCount; i++) {
+      uint16_t id = uint16_t(parent.firstChild + i);
+      const FilterState& s = states_[id];
+      if (s.hash == hash && s.keyLength == str.size() &&
+          stringEquals(str, adaptString(s.key, s.keyLength))) {
+        if (s.kind == FilterState::Null)
+          break;
+        return child(id);
+      }
+    }
+    return child(parent.wildcard);
+  }
+
+ private:
+  const FilterState& state() const {
+    return states_[index_];
+  }
+
+  FilterState::Kind kind() const {
+    return states_ ? state().kind : FilterState::Reject;
+  }
+
+  CompiledFilterRef child(uint16_t index) const {
+    if (index == FilterState::none)
+      return CompiledFilterRef();
+    return CompiledFilterRef(states_, index);
+  }
+
+  const FilterState* states_;
+  uint16_t index_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+namespace DeserializationOption {
+
+// A Filter preprocessed into a table of states, so that the deserializer
+// does one hash comparison per key instead of walking the filter document.
+// MaxStates is the number of values in the filter document.
+// The filter document must outlive this object (keys aren't copied).
+// If the document is too large, the compiled filter allows everything; check
+// overflowed().
+template <size_t MaxStates>
+class CompiledFilter {
+  static_assert(MaxStates > 0 && MaxStates < detail::FilterState::none,
+                "MaxStates must be in [1, 65534]");
+
+ public:
+  explicit CompiledFilter(JsonVariantConst filter)
+      : count_(1), overflowed_(false) {
+    init(states_[0], JsonString(), filter);
+    compile(0, filter);
+    if (overflowed_) {
+      count_ = 1;
+      states_[0].kind = detail::FilterState::AllowAll;
+    }
+  }
+
+  bool overflowed() const {
+    return overflowed_;
+  }
+
+  // Number of states used
+  size_t size() const {
+    return count_;
+  }
+
+  detail::CompiledFilterRef root() const {
+    return detail::CompiledFilterRef(states_, 0);
+  }
+
+ private:
+  static void init(detail::FilterState& state, JsonString key,
+                   JsonVariantConst value) {
+    using detail::FilterState;
+    state.key = key.c_str();
+    state.keyLength = uint16_t(key.size());
+    state.hash = detail::hashString(key.c_str(), key.size());
+    state.firstChild = 0;
+    state.childCount = 0;
+    state.wildcard = FilterState::none;
+    if (value == true)
+      state.kind = FilterState::AllowAll;
+    else if (value.is<JsonObjectConst>())
+      state.kind = FilterState::Object;
+    else if (value.is<JsonArrayConst>())
+      state.kind = FilterState::Array;
+    else if (value.isNull())
+      state.kind = FilterState::Null;
+    else
+      state.kind = value.as<bool>() ? FilterState::KeepNull
+                                    : FilterState::Reject;
+  }
+
+  // Allocates the children of a state contiguously, then recurses into them
+  void compile(uint16_t index, JsonVariantConst value) {
+    using detail::FilterState;
+    if (states_[index].kind == FilterState::Array) {
+      if (!reserve(index, 1))
+        return;
+      uint16_t id = states_[index].firstChild;
+      init(states_[id], JsonString(), value[0]);
+      compile(id, value[0]);
+    } else if (states_[index].kind == FilterState::Object) {
+      JsonObjectConst object = value.as<JsonObjectConst>();
+      if (!reserve(index, object.size()))
+        return;
+      uint16_t id = states_[index].firstChild;
+      for (JsonPairConst member : object) {
+        if (member.key().size() >= FilterState::none) {
+          overflowed_ = true;
+          return;
+        }
+        init(states_[id], member.key(), member.value());
+        if (states_[index].wildcard == FilterState::none &&
+            member.key() == "*")
+          states_[index].wildcard = id;
+        id++;
+      }
+      id = states_[index].firstChild;
+      for (JsonPairConst member : object)
+        compile(id++, member.value());
+    }
+  }
+
+  bool reserve(uint16_t index, size_t n) {
+    if (overflowed_ || n > MaxStates - count_) {
+      overflowed_ = true;
+      return false;
+    }
+    states_[index].firstChild = uint16_t(count_);
+    states_[index].childCount = uint16_t(n);
+    count_ += n;
+    return true;
+  }
+
+  detail::FilterState states_[MaxStates];
+  size_t count_;
+  bool overflowed_;
+};
+
+}  // namespace DeserializationOption
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// deserializeJson(doc, input, compiledFilter) passes the root state
+template <size_t MaxStates>
+inline DeserializationOptions<CompiledFilterRef> makeDeserializationOptions(
+    const DeserializationOption::CompiledFilter<MaxStates>& filter,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return {filter.root(), nestingLimit};
+}
+
+template <size_t MaxStates>
+inline DeserializationOptions<CompiledFilterRef> makeDeserializationOptions(
+    DeserializationOption::NestingLimit nestingLimit,
+    const DeserializationOption::CompiledFilter<MaxStates>& filter) {
+  return {filter.root(), nestingLimit};
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
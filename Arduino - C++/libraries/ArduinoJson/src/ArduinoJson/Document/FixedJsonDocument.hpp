@@ -0,0 +1,78 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Memory/ArenaAllocator.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Holds the buffer and the allocator; a base class of FixedJsonDocument so
+// that they're constructed before JsonDocument
+template <size_t Capacity>
+class FixedArena {
+ protected:
+  FixedArena() : allocator_(buffer_, Capacity) {}
+
+  alignas(ArenaAlignment) uint8_t buffer_[Capacity];
+  ArenaAllocator allocator_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A JsonDocument whose memory lives inside the object: no heap allocation,
+// and a worst case known at compile time.
+// Capacity includes the memory pools, the strings, and a small header for
+// each block; use arena().peak() to tune it. It must hold at least one pool
+// of ARDUINOJSON_POOL_CAPACITY slots, so reduce ARDUINOJSON_POOL_CAPACITY
+// for small documents.
+// When the buffer is full, the document behaves as with a failing
+// allocator: overflowed() returns true, and deserializeJson() returns
+// NoMemory.
+// Copies and assignments copy the content; never swap it with a
+// JsonDocument, since the allocator belongs to the object.
+template <size_t Capacity>
+class FixedJsonDocument : private detail::FixedArena<Capacity>,
+                          public JsonDocument {
+ public:
+  FixedJsonDocument() : JsonDocument(&this->allocator_) {}
+
+  FixedJsonDocument(const FixedJsonDocument& src)
+      : JsonDocument(&this->allocator_) {
+    set(src);
+  }
+
+  // Copies a variant, an array, an object, or another document
+  template <typename T,
+            typename = detail::enable_if_t<
+                detail::IsVariant<T>::value ||
+                detail::is_base_of<JsonDocument, T>::value ||
+                detail::is_same<JsonArray, T>::value ||
+                detail::is_same<JsonArrayConst, T>::value ||
+                detail::is_same<JsonObject, T>::value ||
+                detail::is_same<JsonObjectConst, T>::value>>
+  FixedJsonDocument(const T& src) : JsonDocument(&this->allocator_) {
+    set(src);
+  }
+
+  FixedJsonDocument& operator=(const FixedJsonDocument& src) {
+    set(src);
+    return *this;
+  }
+
+  template <typename T>
+  FixedJsonDocument& operator=(const T& src) {
+    set(src);
+    return *this;
+  }
+
+  const ArenaAllocator& arena() const {
+    return this->allocator_;
+  }
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
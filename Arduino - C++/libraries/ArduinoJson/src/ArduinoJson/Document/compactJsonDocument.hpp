@@ -0,0 +1,34 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Rewrites the document into fresh memory pools, then releases the old ones.
+// After many removals and additions, the slots of a document are scattered
+// over pools that can't be released, and iterations jump between them.
+// Copying the content packs the slots in depth-first order, which is the
+// order of iteration, and stores each string once; shrinkToFit() then
+// trims the last pool.
+//
+//   compactJsonDocument(doc);
+//
+// Peak memory is twice the size of the content. If an allocation fails, the
+// document is left untouched and the function returns false.
+// Not for a FixedJsonDocument: its arena can't reclaim the old blocks while
+// the new ones sit above them.
+inline bool compactJsonDocument(JsonDocument& doc) {
+  JsonDocument copy(doc);  // same allocator
+  if (copy.overflowed())
+    return false;
+  doc = detail::move(copy);
+  doc.shrinkToFit();
+  return true;
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,651 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/DeserializationError.hpp>
+#include <ArduinoJson/Deserialization/NestingLimit.hpp>
+#include <ArduinoJson/Deserialization/Reader.hpp>
+#include <ArduinoJson/Numbers/parseFloatFast.hpp>
+#include <ArduinoJson/Polyfills/ctype.hpp>
+
+#include <stdint.h>  // uint64_t
+#include <stdlib.h>  // strtod
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Accepts the decimal numbers that strtod() accepts, without converting
+// them (the value may never be read)
+inline bool isDecimalNumber(const char* s, const char* end) {
+  if (s != end && (*s == '-' || *s == '+'))
+    s++;
+  bool hasDigits = false;
+  for (; s != end && isdigit(*s); s++)
+    hasDigits = true;
+  if (s != end && *s == '.')
+    for (s++; s != end && isdigit(*s); s++)
+      hasDigits = true;
+  if (!hasDigits)
+    return false;
+  if (s != end && (*s == 'e' || *s == 'E')) {
+    s++;
+    if (s != end && (*s == '-' || *s == '+'))
+      s++;
+    if (s == end || !isdigit(*s))
+      return false;
+    while (s != end && isdigit(*s))
+      s++;
+  }
+  return s == end;
+}
+
+// Parses the run of decimal digits at the beginning of [s, end).
+// Returns a pointer past the last digit, or nullptr if the value doesn't fit
+// in a uint64_t.
+inline const char* parseDigits(const char* s, const char* end,
+                               uint64_t& result) {
+  const uint64_t maxValue = 0xFFFFFFFFFFFFFFFFULL;
+  uint64_t value = 0;
+  for (; s != end && isdigit(*s); s++) {
+    uint8_t digit = uint8_t(*s - '0');
+    if (value > (maxValue - digit) / 10)
+      return nullptr;
+    value = value * 10 + digit;
+  }
+  result = value;
+  return s;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+namespace JsonEvent {
+enum Type {
+  None,
+  BeginObject,
+  EndObject,
+  BeginArray,
+  EndArray,
+  Key,
+  String,
+  Number,
+  Boolean,
+  Null,
+  End,
+  Error,
+};
+}  // namespace JsonEvent
+
+// Pull parser: reads a JSON document one token at a time, from any input
+// supported by deserializeJson().
+// Memory use is the caller's text buffer (for one key, string, or number)
+// plus one bit per nesting level, whatever the size of the document.
+template <typename TReader>
+class JsonReader {
+ public:
+  using Event = JsonEvent::Type;
+
+  class Subtree;
+
+  JsonReader(TReader reader, char* buffer, size_t bufferSize,
+             DeserializationOption::NestingLimit nestingLimit = {})
+      : reader_(reader),
+        buffer_(buffer),
+        bufferSize_(bufferSize),
+        length_(0),
+        peek_(0),
+        hasPeek_(false),
+        truncate_(false),
+        truncated_(false),
+        stack_(0),
+        depth_(0),
+        maxDepth_(0),
+        state_(ExpectValue),
+        event_(JsonEvent::None),
+        error_(DeserializationError::Ok) {
+    while (!nestingLimit.reached() && maxDepth_ < maxSupportedDepth) {
+      nestingLimit = nestingLimit.decrement();
+      maxDepth_++;
+    }
+    if (bufferSize_)
+      buffer_[0] = 0;
+  }
+
+  // Reads the next token and returns its event.
+  // Once End or Error is returned, all subsequent calls return the same.
+  Event next() {
+    if (event_ == JsonEvent::End || event_ == JsonEvent::Error)
+      return event_;
+    switch (state_) {
+      case ExpectValue:
+        return readValue();
+      case ExpectValueOrEndArray:
+        if (peekAfterSpaces() == ']')
+          return closeContainer(']');
+        return readValue();
+      case ExpectKeyOrEndObject:
+        if (peekAfterSpaces() == '}')
+          return closeContainer('}');
+        return readKey();
+      case ExpectColon:
+        if (peekAfterSpaces() != ':')
+          return fail(peek_ < 0 ? DeserializationError::IncompleteInput
+                                : DeserializationError::InvalidInput);
+        consume();
+        return readValue();
+      case ExpectCommaOrEnd: {
+        int c = peekAfterSpaces();
+        if (c == ',') {
+          consume();
+          return inObject() ? readKey() : readValue();
+        }
+        return closeContainer(c);
+      }
+      case Done:
+        break;
+    }
+    return setEvent(JsonEvent::End);
+  }
+
+  Event event() const {
+    return event_;
+  }
+
+  DeserializationError error() const {
+    return error_;
+  }
+
+  // Number of enclosing objects and arrays
+  size_t depth() const {
+    return depth_;
+  }
+
+  // Text of the current key, string, or number (null-terminated)
+  const char* text() const {
+    return buffer_;
+  }
+
+  size_t textLength() const {
+    return length_;
+  }
+
+  // Lets keys, strings, and numbers longer than the buffer be truncated
+  // instead of failing with NoMemory
+  void allowTruncation(bool allow) {
+    truncate_ = allow;
+  }
+
+  bool asBool() const {
+    return event_ == JsonEvent::Boolean && buffer_[0] == 't';
+  }
+
+  // Converts the current number, or a string holding a number (Firestore's
+  // integerValue), to a double. Returns 0 if not a number.
+  double asDouble() const {
+    if (event_ != JsonEvent::Number && event_ != JsonEvent::String)
+      return 0;
+    double value = 0;
+    if (detail::parseFloatFast(buffer_, buffer_ + length_, value) ==
+        buffer_ + length_)
+      return value;
+    char* end;
+    value = strtod(buffer_, &end);  // more than 19 digits, close to a tie
+    return end == buffer_ + length_ ? value : 0;
+  }
+
+  // Converts the current number, or a string holding a number, to an integer.
+  // Returns 0 if not a number or out of range; truncates decimals.
+  int64_t asInteger() const {
+    if (event_ != JsonEvent::Number && event_ != JsonEvent::String)
+      return 0;
+    const char* begin = buffer_;
+    const char* end = buffer_ + length_;
+    bool negative = begin != end && *begin == '-';
+    uint64_t magnitude;
+    const char* p = detail::parseDigits(begin + negative, end, magnitude);
+    if (p == end && p != begin + negative) {
+      const uint64_t limit = uint64_t(INT64_MAX) + negative;
+      if (magnitude > limit)
+        return 0;
+      return negative ? int64_t(0 - magnitude) : int64_t(magnitude);
+    }
+    double value = asDouble();
+    if (value >= -9223372036854775808.0 && value < 9223372036854775808.0)
+      return int64_t(value);
+    return 0;
+  }
+
+  // Skips what follows the current event without storing it:
+  // - after BeginObject or BeginArray, the rest of the container (the event
+  //   becomes EndObject or EndArray);
+  // - after Key, the value (the event becomes the one that ends the value).
+  // Strings larger than the buffer can be skipped.
+  void skip() {
+    if (event_ == JsonEvent::Key) {
+      bool truncate = truncate_;
+      truncate_ = true;  // the text of the value is discarded anyway
+      Event e = next();
+      truncate_ = truncate;
+      if (e != JsonEvent::BeginObject && e != JsonEvent::BeginArray)
+        return;
+    }
+    if (event_ != JsonEvent::BeginObject && event_ != JsonEvent::BeginArray)
+      return;
+    Subtree subtree(this);
+    while (subtree.read() >= 0) {
+    }
+  }
+
+  // Returns a stream that yields the raw JSON of the container that just
+  // began (BeginObject or BeginArray), including the opening bracket.
+  // Pass it to deserializeJson() to materialize only this subtree; it must be
+  // read to the end before calling next() again.
+  Subtree subtree() {
+    return Subtree(this);
+  }
+
+  // Deserializes the container that just began into doc
+  template <typename TDocument>
+  DeserializationError read(TDocument& doc) {
+    if (event_ != JsonEvent::BeginObject && event_ != JsonEvent::BeginArray)
+      return DeserializationError::InvalidInput;
+    Subtree stream(this);
+    DeserializationError err = deserializeJson(doc, stream);
+    while (stream.read() >= 0) {  // in case deserializeJson() stopped early
+    }
+    if (!error_ && err)
+      error_ = err;
+    return err;
+  }
+
+  class Subtree {
+   public:
+    explicit Subtree(JsonReader* reader)
+        : reader_(reader),
+          opening_(reader->event_ == JsonEvent::BeginObject  ? '{'
+                   : reader->event_ == JsonEvent::BeginArray ? '['
+                                                             : 0),
+          nesting_(0),
+          inString_(0),
+          escaped_(false) {}
+
+    int read() {
+      if (opening_) {
+        int c = opening_;
+        opening_ = 0;
+        nesting_ = 1;
+        return c;
+      }
+      if (nesting_ == 0)
+        return -1;
+      int c = reader_->readRaw();
+      if (c <= 0) {
+        nesting_ = 0;
+        reader_->fail(DeserializationError::IncompleteInput);
+        return -1;
+      }
+      track(char(c));
+      if (nesting_ == 0)
+        reader_->closeSubtree(char(c));
+      return c;
+    }
+
+    size_t readBytes(char* buffer, size_t length) {
+      size_t n = 0;
+      while (n < length) {
+        int c = read();
+        if (c < 0)
+          break;
+        buffer[n++] = char(c);
+      }
+      return n;
+    }
+
+   private:
+    void track(char c) {
+      if (inString_) {
+        if (escaped_)
+          escaped_ = false;
+        else if (c == '\\')
+          escaped_ = true;
+        else if (c == inString_)
+          inString_ = 0;
+      } else if (c == '"' || c == '\'') {
+        inString_ = c;
+      } else if (c == '{' || c == '[') {
+        nesting_++;
+      } else if (c == '}' || c == ']') {
+        nesting_--;
+      }
+    }
+
+    JsonReader* reader_;
+    char opening_;
+    size_t nesting_;
+    char inString_;
+    bool escaped_;
+  };
+
+ private:
+  enum State {
+    ExpectValue,
+    ExpectValueOrEndArray,
+    ExpectKeyOrEndObject,
+    ExpectColon,
+    ExpectCommaOrEnd,
+    Done,
+  };
+
+  static constexpr uint8_t maxSupportedDepth = 64;  // bits in stack_
+
+  int readRaw() {
+    if (hasPeek_) {
+      hasPeek_ = false;
+      return peek_;
+    }
+    return reader_.read();
+  }
+
+  int peek() {
+    if (!hasPeek_) {
+      peek_ = reader_.read();
+      if (peek_ == 0)  // null-terminated inputs end here
+        peek_ = -1;
+      hasPeek_ = true;
+    }
+    return peek_;
+  }
+
+  void consume() {
+    hasPeek_ = false;
+  }
+
+  int peekAfterSpaces() {
+    for (;;) {
+      int c = peek();
+      if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+        return c;
+      consume();
+    }
+  }
+
+  bool inObject() const {
+    return (stack_ >> (depth_ - 1)) & 1;
+  }
+
+  Event setEvent(Event e) {
+    event_ = e;
+    return e;
+  }
+
+  Event fail(DeserializationError err) {
+    error_ = err;
+    state_ = Done;
+    length_ = 0;
+    if (bufferSize_)
+      buffer_[0] = 0;
+    return setEvent(JsonEvent::Error);
+  }
+
+  void valueDone() {
+    state_ = depth_ ? ExpectCommaOrEnd : Done;
+  }
+
+  Event closeContainer(int c) {
+    if (c < 0)
+      return fail(DeserializationError::IncompleteInput);
+    if (c != (inObject() ? '}' : ']'))
+      return fail(DeserializationError::InvalidInput);
+    consume();
+    Event e = inObject() ? JsonEvent::EndObject : JsonEvent::EndArray;
+    depth_--;
+    valueDone();
+    return setEvent(e);
+  }
+
+  // Called by Subtree once it has passed the closing bracket
+  void closeSubtree(char c) {
+    depth_--;
+    valueDone();
+    setEvent(c == '}' ? JsonEvent::EndObject : JsonEvent::EndArray);
+  }
+
+  Event openContainer(bool isObject) {
+    if (depth_ >= maxDepth_)
+      return fail(DeserializationError::TooDeep);
+    consume();
+    uint64_t bit = uint64_t(1) << depth_;
+    stack_ = isObject ? stack_ | bit : stack_ & ~bit;
+    depth_++;
+    state_ = isObject ? ExpectKeyOrEndObject : ExpectValueOrEndArray;
+    return setEvent(isObject ? JsonEvent::BeginObject : JsonEvent::BeginArray);
+  }
+
+  Event readValue() {
+    int c = peekAfterSpaces();
+    switch (c) {
+      case -1:
+        return fail(event_ == JsonEvent::None
+                        ? DeserializationError::EmptyInput
+                        : DeserializationError::IncompleteInput);
+      case '{':
+        return openContainer(true);
+      case '[':
+        return openContainer(false);
+      case '"':
+      case '\'':
+        return readString(JsonEvent::String);
+      case 't':
+        return readLiteral("true", JsonEvent::Boolean);
+      case 'f':
+        return readLiteral("false", JsonEvent::Boolean);
+      case 'n':
+        return readLiteral("null", JsonEvent::Null);
+      default:
+        if (c == '-' || (c >= '0' && c <= '9'))
+          return readNumber();
+        return fail(DeserializationError::InvalidInput);
+    }
+  }
+
+  Event readKey() {
+    int c = peekAfterSpaces();
+    if (c < 0)
+      return fail(DeserializationError::IncompleteInput);
+    if (c != '"' && c != '\'')
+      return fail(DeserializationError::InvalidInput);
+    return readString(JsonEvent::Key);
+  }
+
+  bool append(char c) {
+    if (length_ + 1 >= bufferSize_) {
+      truncated_ = true;
+      return truncate_;
+    }
+    buffer_[length_++] = c;
+    buffer_[length_] = 0;
+    return true;
+  }
+
+  Event readLiteral(const char* literal, Event e) {
+    length_ = 0;
+    for (const char* p = literal; *p; p++) {
+      int c = peek();
+      if (c < 0)
+        return fail(DeserializationError::IncompleteInput);
+      if (c != *p)
+        return fail(DeserializationError::InvalidInput);
+      consume();
+      if (!append(*p))
+        return fail(DeserializationError::NoMemory);
+    }
+    valueDone();
+    return setEvent(e);
+  }
+
+  Event readNumber() {
+    length_ = 0;
+    truncated_ = false;
+    for (;;) {
+      int c = peek();
+      bool isNumberChar = (c >= '0' && c <= '9') || c == '-' || c == '+' ||
+                          c == '.' || c == 'e' || c == 'E';
+      if (!isNumberChar)
+        break;
+      consume();
+      if (!append(char(c)))
+        return fail(DeserializationError::NoMemory);
+    }
+    // a truncated number can't be checked
+    if (!truncated_ && !detail::isDecimalNumber(buffer_, buffer_ + length_))
+      return fail(DeserializationError::InvalidInput);
+    valueDone();
+    return setEvent(JsonEvent::Number);
+  }
+
+  int readHex4() {
+    int value = 0;
+    for (int i = 0; i < 4; i++) {
+      int c = peek();
+      consume();
+      if (c >= '0' && c <= '9')
+        value = value * 16 + (c - '0');
+      else if (c >= 'a' && c <= 'f')
+        value = value * 16 + (c - 'a' + 10);
+      else if (c >= 'A' && c <= 'F')
+        value = value * 16 + (c - 'A' + 10);
+      else
+        return -1;
+    }
+    return value;
+  }
+
+  bool appendCodepoint(uint32_t cp) {
+    if (cp < 0x80)
+      return append(char(cp));
+    if (cp < 0x800)
+      return append(char(0xC0 | (cp >> 6))) &&
+             append(char(0x80 | (cp & 0x3F)));
+    if (cp < 0x10000)
+      return append(char(0xE0 | (cp >> 12))) &&
+             append(char(0x80 | ((cp >> 6) & 0x3F))) &&
+             append(char(0x80 | (cp & 0x3F)));
+    return append(char(0xF0 | (cp >> 18))) &&
+           append(char(0x80 | ((cp >> 12) & 0x3F))) &&
+           append(char(0x80 | ((cp >> 6) & 0x3F))) &&
+           append(char(0x80 | (cp & 0x3F)));
+  }
+
+  Event readString(Event e) {
+    char quote = char(peek());
+    consume();
+    length_ = 0;
+    if (bufferSize_)
+      buffer_[0] = 0;
+    for (;;) {
+      int c = peek();
+      if (c < 0)
+        return fail(DeserializationError::IncompleteInput);
+      consume();
+      if (c == quote)
+        break;
+      if (c == '\\') {
+        c = peek();
+        if (c < 0)
+          return fail(DeserializationError::IncompleteInput);
+        consume();
+        uint32_t cp;
+        switch (c) {
+          case '"':
+          case '\'':
+          case '\\':
+          case '/':
+            cp = uint32_t(c);
+            break;
+          case 'b':
+            cp = '\b';
+            break;
+          case 'f':
+            cp = '\f';
+            break;
+          case 'n':
+            cp = '\n';
+            break;
+          case 'r':
+            cp = '\r';
+            break;
+          case 't':
+            cp = '\t';
+            break;
+          case 'u': {
+            int unit = readHex4();
+            if (unit < 0)
+              return fail(DeserializationError::InvalidInput);
+            cp = uint32_t(unit);
+            if (cp >= 0xD800 && cp < 0xDC00) {  // high surrogate
+              if (peek() != '\\')
+                return fail(DeserializationError::InvalidInput);
+              consume();
+              if (peek() != 'u')
+                return fail(DeserializationError::InvalidInput);
+              consume();
+              int low = readHex4();
+              if (low < 0xDC00 || low >= 0xE000)
+                return fail(DeserializationError::InvalidInput);
+              cp = 0x10000 + ((cp - 0xD800) << 10) + uint32_t(low - 0xDC00);
+            }
+            break;
+          }
+          default:
+            return fail(DeserializationError::InvalidInput);
+        }
+        if (!appendCodepoint(cp))
+          return fail(DeserializationError::NoMemory);
+      } else if (!append(char(c))) {
+        return fail(DeserializationError::NoMemory);
+      }
+    }
+    if (e == JsonEvent::Key)
+      state_ = ExpectColon;
+    else
+      valueDone();
+    return setEvent(e);
+  }
+
+  TReader reader_;
+  char* buffer_;
+  size_t bufferSize_;
+  size_t length_;
+  int peek_;
+  bool hasPeek_;
+  bool truncate_;
+  bool truncated_;  // append() dropped chars from the current token
+  uint64_t stack_;  // one bit per level: 1 for object, 0 for array
+  uint8_t depth_;
+  uint8_t maxDepth_;
+  State state_;
+  Event event_;
+  DeserializationError error_;
+};
+
+// Creates a JsonReader that stores keys and strings in buffer
+template <typename TInput>
+JsonReader<detail::Reader<detail::remove_reference_t<TInput>>> makeJsonReader(
+    TInput&& input, char* buffer, size_t bufferSize,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return JsonReader<detail::Reader<detail::remove_reference_t<TInput>>>(
+      detail::makeReader(detail::forward<TInput>(input)), buffer, bufferSize,
+      nestingLimit);
+}
+
+template <typename TInput, size_t N>
+JsonReader<detail::Reader<detail::remove_reference_t<TInput>>> makeJsonReader(
+    TInput&& input, char (&buffer)[N],
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return makeJsonReader(detail::forward<TInput>(input), buffer, N,
+                        nestingLimit);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,123 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonWriter.hpp>
+#include <ArduinoJson/Serialization/Writer.hpp>
+#include <ArduinoJson/Serialization/Writers/StaticStringWriter.hpp>
+
+#include <stdint.h>  // uint8_t
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A JSON message whose shape is known in advance: the constant parts are
+// written as is, and each "?" is replaced by a value.
+//
+//   JsonTemplate<2> telemetry("{\"temperature\":?,\"humidity\":?}");
+//   telemetry.serialize(client, 21.5, 40);
+//
+// The text is scanned once, in the constructor, to find the placeholders
+// (a "?" inside a string is not one); it must outlive the template.
+// serialize() then copies the constant fragments in one write each, and
+// formats the values like JsonWriter::value(): strings are escaped, and
+// numbers get the same digits as with serializeJson().
+// The text is not validated: the constant parts must be valid JSON, and the
+// placeholders must be at the positions of values.
+// MsgPackTemplate does the same for MessagePack.
+template <size_t MaxPlaceholders>
+class JsonTemplate {
+  static_assert(MaxPlaceholders > 0, "MaxPlaceholders must be positive");
+
+ public:
+  explicit JsonTemplate(const char* json)
+      : text_(json), length_(0), count_(0), valid_(json != nullptr) {
+    if (!valid_)
+      return;
+    char quote = 0;  // inside a string?
+    for (; json[length_]; length_++) {
+      char c = json[length_];
+      if (quote) {
+        if (c == '\\' && json[length_ + 1])
+          length_++;
+        else if (c == quote)
+          quote = 0;
+      } else if (c == '"' || c == '\'') {
+        quote = c;
+      } else if (c == '?') {
+        if (count_ < MaxPlaceholders)
+          offsets_[count_] = length_;
+        else
+          valid_ = false;
+        count_++;
+      }
+    }
+  }
+
+  // Returns false if the text is null or has more than MaxPlaceholders
+  bool valid() const {
+    return valid_;
+  }
+
+  size_t placeholders() const {
+    return count_;
+  }
+
+  // Writes the message to any destination supported by serializeJson().
+  // Returns the number of bytes written, or 0 if the number of values
+  // doesn't match the number of placeholders.
+  template <typename TDestination, typename... TValues>
+  size_t serialize(TDestination& destination, const TValues&... values) const {
+    if (!valid_ || sizeof...(TValues) != count_)
+      return 0;
+    detail::Writer<TDestination> writer(destination);
+    return writeFrom(writer, 0, values...);
+  }
+
+  // Writes the message to a char buffer, adding a terminator if possible
+  template <typename... TValues>
+  size_t serialize(char* buffer, size_t bufferSize,
+                   const TValues&... values) const {
+    if (!valid_ || sizeof...(TValues) != count_)
+      return 0;
+    detail::StaticStringWriter writer(buffer, bufferSize);
+    size_t n = writeFrom(writer, 0, values...);
+    if (n < bufferSize)
+      buffer[n] = 0;
+    return n;
+  }
+
+ private:
+  // Writes the fragment that precedes placeholder i (or ends the message)
+  template <typename TWriter>
+  size_t writeFragment(TWriter& writer, size_t i) const {
+    size_t begin = i == 0 ? 0 : offsets_[i - 1] + 1;
+    size_t end = i < count_ ? offsets_[i] : length_;
+    return writer.write(reinterpret_cast<const uint8_t*>(text_ + begin),
+                        end - begin);
+  }
+
+  template <typename TWriter>
+  size_t writeFrom(TWriter& writer, size_t i) const {
+    return writeFragment(writer, i);
+  }
+
+  template <typename TWriter, typename TValue, typename... TValues>
+  size_t writeFrom(TWriter& writer, size_t i, const TValue& value,
+                   const TValues&... values) const {
+    size_t n = writeFragment(writer, i);
+    JsonWriter<TWriter&> json(writer);
+    json.value(value);
+    n += json.bytesWritten();
+    return n + writeFrom(writer, i + 1, values...);
+  }
+
+  const char* text_;
+  size_t length_;
+  size_t offsets_[MaxPlaceholders];  // of each "?"
+  size_t count_;
+  bool valid_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,423 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArrayConst.hpp>
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Numbers/FloatParts.hpp>
+#include <ArduinoJson/Numbers/JsonFloat.hpp>
+#include <ArduinoJson/Object/JsonObjectConst.hpp>
+#include <ArduinoJson/Polyfills/math.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Serialization/Writer.hpp>
+#include <ArduinoJson/Strings/IsString.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <stdint.h>  // uint64_t
+#include <string.h>  // strlen
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Writes a JSON document token by token, without building a JsonDocument:
+//
+//   auto writer = makeJsonWriter(client);
+//   writer.beginObject();
+//   writer.key("temperature");
+//   writer.value(21.5);
+//   writer.key("readings");
+//   writer.beginArray();
+//   for (int r : readings)
+//     writer.value(r);
+//   writer.endArray();
+//   writer.endObject();
+//
+// Memory use is one bit per nesting level, whatever the size of the output.
+// Each call checks that it's valid at this point of the document (e.g. no
+// value in an object without a key); an invalid call, or a destination that
+// refuses bytes, makes it and all the following calls return false.
+template <typename TWriter>
+class JsonWriter {
+ public:
+  explicit JsonWriter(TWriter writer, bool pretty = false)
+      : writer_(writer),
+        stack_(0),
+        count_(0),
+        depth_(0),
+        pretty_(pretty),
+        hasElements_(false),
+        afterKey_(false),
+        done_(false),
+        failed_(false) {}
+
+  bool beginObject() {
+    return beginContainer(true);
+  }
+
+  bool endObject() {
+    return endContainer(true);
+  }
+
+  bool beginArray() {
+    return beginContainer(false);
+  }
+
+  bool endArray() {
+    return endContainer(false);
+  }
+
+  template <typename TString>
+  detail::enable_if_t<detail::IsString<TString>::value, bool> key(
+      const TString& key) {
+    if (failed_ || !inObject() || afterKey_)
+      return fail();
+    writeSeparator();
+    writeString(detail::adaptString(key));
+    write(':');
+    if (pretty_)
+      write(' ');
+    afterKey_ = true;
+    return !failed_;
+  }
+
+  template <typename TString>
+  detail::enable_if_t<detail::IsString<TString>::value, bool> value(
+      const TString& s) {
+    if (!beginValue())
+      return false;
+    auto adapted = detail::adaptString(s);
+    if (adapted.isNull())
+      writeRaw("null");
+    else
+      writeString(adapted);
+    return endValue();
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_integral<T>::value &&
+                          !detail::is_same<T, bool>::value,
+                      bool>
+  value(T n) {
+    if (!beginValue())
+      return false;
+    writeInteger(n);
+    return endValue();
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_floating_point<T>::value, bool> value(T n) {
+    if (!beginValue())
+      return false;
+    writeFloat(n);
+    return endValue();
+  }
+
+  bool value(bool b) {
+    if (!beginValue())
+      return false;
+    writeRaw(b ? "true" : "false");
+    return endValue();
+  }
+
+  bool value(decltype(nullptr)) {
+    if (!beginValue())
+      return false;
+    writeRaw("null");
+    return endValue();
+  }
+
+  // Writes a whole variant at the current position, e.g. a member of a
+  // document that was received earlier.
+  // Scalars, including serialized() values, are written by serializeJson().
+  bool value(JsonVariantConst variant) {
+    if (variant.is<JsonObjectConst>()) {
+      if (!beginObject())
+        return false;
+      for (JsonPairConst member : variant.as<JsonObjectConst>())
+        if (!key(member.key()) || !value(member.value()))
+          return false;
+      return endObject();
+    }
+    if (variant.is<JsonArrayConst>()) {
+      if (!beginArray())
+        return false;
+      for (JsonVariantConst element : variant.as<JsonArrayConst>())
+        if (!value(element))
+          return false;
+      return endArray();
+    }
+    if (!beginValue())
+      return false;
+    size_t expected = measureJson(variant);
+    size_t written = serializeJson(variant, writer_);
+    count_ += written;
+    if (written < expected)
+      failed_ = true;
+    return endValue();
+  }
+
+  // Number of enclosing objects and arrays
+  size_t depth() const {
+    return depth_;
+  }
+
+  // Returns true once the root value is complete
+  bool done() const {
+    return done_ && !failed_;
+  }
+
+  // Returns true after an invalid call or a write error
+  bool failed() const {
+    return failed_;
+  }
+
+  // Number of bytes written so far
+  size_t bytesWritten() const {
+    return count_;
+  }
+
+ private:
+  static constexpr uint8_t maxSupportedDepth = 64;  // bits in stack_
+
+  bool inObject() const {
+    return depth_ > 0 && ((stack_ >> (depth_ - 1)) & 1);
+  }
+
+  bool fail() {
+    failed_ = true;
+    return false;
+  }
+
+  // A value is allowed at the root, in an array, or after a key
+  bool beginValue() {
+    if (failed_ || done_ || (inObject() && !afterKey_))
+      return fail();
+    if (!afterKey_)
+      writeSeparator();
+    afterKey_ = false;
+    return true;
+  }
+
+  bool endValue() {
+    hasElements_ = true;
+    if (depth_ == 0)
+      done_ = true;
+    return !failed_;
+  }
+
+  bool beginContainer(bool isObject) {
+    if (depth_ >= maxSupportedDepth || !beginValue())
+      return fail();
+    write(isObject ? '{' : '[');
+    uint64_t bit = uint64_t(1) << depth_;
+    stack_ = isObject ? stack_ | bit : stack_ & ~bit;
+    depth_++;
+    hasElements_ = false;
+    return !failed_;
+  }
+
+  bool endContainer(bool isObject) {
+    if (failed_ || depth_ == 0 || inObject() != isObject || afterKey_)
+      return fail();
+    depth_--;
+    if (pretty_ && hasElements_)
+      writeNewLine();
+    write(isObject ? '}' : ']');
+    return endValue();
+  }
+
+  // Writes the comma and the indentation before an element or a key
+  void writeSeparator() {
+    if (depth_ == 0)
+      return;
+    if (hasElements_)
+      write(',');
+    if (pretty_)
+      writeNewLine();
+  }
+
+  void writeNewLine() {
+    write('\n');
+    for (uint8_t i = 0; i < depth_; i++)
+      writeRaw("  ");
+  }
+
+  template <typename TAdaptedString>
+  void writeString(TAdaptedString s) {
+    // escapes into a small buffer to write in chunks, not char by char
+    char buffer[32];
+    size_t n = 0;
+    buffer[n++] = '"';
+    for (size_t i = 0; i < s.size(); i++) {
+      if (n > sizeof(buffer) - 6) {  // room for the longest escape
+        write(buffer, n);
+        n = 0;
+      }
+      char c = s[i];
+      char escaped = escapeChar(c);
+      if (escaped) {
+        buffer[n++] = '\\';
+        buffer[n++] = escaped;
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        const char* hex = "0123456789abcdef";
+        buffer[n++] = '\\';
+        buffer[n++] = 'u';
+        buffer[n++] = '0';
+        buffer[n++] = '0';
+        buffer[n++] = hex[(c >> 4) & 0xF];
+        buffer[n++] = hex[c & 0xF];
+      } else {
+        buffer[n++] = c;
+      }
+    }
+    if (n == sizeof(buffer)) {
+      write(buffer, n);
+      n = 0;
+    }
+    buffer[n++] = '"';
+    write(buffer, n);
+  }
+
+  static char escapeChar(char c) {
+    switch (c) {
+      case '"':
+        return '"';
+      case '\\':
+        return '\\';
+      case '\b':
+        return 'b';
+      case '\f':
+        return 'f';
+      case '\n':
+        return 'n';
+      case '\r':
+        return 'r';
+      case '\t':
+        return 't';
+      default:
+        return 0;
+    }
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_signed<T>::value> writeInteger(T n) {
+    using unsigned_type = detail::make_unsigned_t<T>;
+    unsigned_type magnitude;
+    if (n < 0) {
+      write('-');
+      magnitude = unsigned_type(unsigned_type(~n) + 1);
+    } else {
+      magnitude = unsigned_type(n);
+    }
+    writeInteger(magnitude);
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_unsigned<T>::value> writeInteger(T n) {
+    char buffer[22];
+    char* end = buffer + sizeof(buffer);
+    char* begin = end;
+    do {
+      *--begin = char(n % 10 + '0');
+      n = T(n / 10);
+    } while (n);
+    write(begin, size_t(end - begin));
+  }
+
+  // Same digits as serializeJson(): 9 decimal places for a double, 6 for a
+  // float
+  template <typename T>
+  void writeFloat(T n) {
+    writeFloat(JsonFloat(n), sizeof(T) >= 8 ? 9 : 6);
+  }
+
+  void writeFloat(JsonFloat n, int8_t decimalPlaces) {
+    if (detail::isnan(n))
+      return writeRaw(ARDUINOJSON_ENABLE_NAN ? "NaN" : "null");
+
+#if ARDUINOJSON_ENABLE_INFINITY
+    if (n < 0.0) {
+      write('-');
+      n = -n;
+    }
+    if (detail::isinf(n))
+      return writeRaw("Infinity");
+#else
+    if (detail::isinf(n))
+      return writeRaw("null");
+    if (n < 0.0) {
+      write('-');
+      n = -n;
+    }
+#endif
+
+    auto parts = detail::decomposeFloat(n, decimalPlaces);
+    writeInteger(parts.integral);
+    if (parts.decimalPlaces)
+      writeDecimals(parts.decimal, parts.decimalPlaces);
+    if (parts.exponent) {
+      write('e');
+      writeInteger(parts.exponent);
+    }
+  }
+
+  void writeDecimals(uint32_t decimal, int8_t width) {
+    char buffer[16];  // all the digits and the dot
+    char* end = buffer + sizeof(buffer);
+    char* begin = end;
+    while (width--) {
+      *--begin = char(decimal % 10 + '0');
+      decimal /= 10;
+    }
+    *--begin = '.';
+    write(begin, size_t(end - begin));
+  }
+
+  void writeRaw(const char* s) {
+    write(s, strlen(s));
+  }
+
+  void write(char c) {
+    if (writer_.write(static_cast<uint8_t>(c)) == 1)
+      count_++;
+    else
+      failed_ = true;
+  }
+
+  void write(const char* s, size_t n) {
+    size_t written = writer_.write(reinterpret_cast<const uint8_t*>(s), n);
+    count_ += written;
+    if (written < n)
+      failed_ = true;
+  }
+
+  TWriter writer_;
+  uint64_t stack_;  // one bit per level: 1 for object, 0 for array
+  size_t count_;
+  uint8_t depth_;
+  bool pretty_;
+  bool hasElements_;  // in the current container
+  bool afterKey_;
+  bool done_;
+  bool failed_;
+};
+
+// Creates a JsonWriter that writes minified JSON to any destination
+// supported by serializeJson()
+template <typename TDestination>
+JsonWriter<detail::Writer<TDestination>> makeJsonWriter(
+    TDestination& destination) {
+  return JsonWriter<detail::Writer<TDestination>>(
+      detail::Writer<TDestination>(destination));
+}
+
+// Same as makeJsonWriter(), with the indentation of serializeJsonPretty()
+template <typename TDestination>
+JsonWriter<detail::Writer<TDestination>> makePrettyJsonWriter(
+    TDestination& destination) {
+  return JsonWriter<detail::Writer<TDestination>>(
+      detail::Writer<TDestination>(destination), true);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
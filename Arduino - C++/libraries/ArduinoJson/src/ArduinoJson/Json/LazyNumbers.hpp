@@ -0,0 +1,275 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Json/JsonReader.hpp>
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Numbers/parseFloatFast.hpp>
+
+#include <stdlib.h>  // strtod
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Copies the value that begins with event e into dst, with the numbers
+// stored as serialized() text
+template <typename TJsonReader>
+bool readLazyValue(TJsonReader& reader, JsonEvent::Type e, JsonVariant dst) {
+  switch (e) {
+    case JsonEvent::BeginObject: {
+      JsonObject object = dst.to<JsonObject>();
+      if (object.isNull())
+        return false;
+      while ((e = reader.next()) == JsonEvent::Key) {
+        // create the member now: the key is lost once the value is read
+        JsonVariant member =
+            object[JsonString(reader.text(), reader.textLength())]
+                .to<JsonVariant>();
+        if (member.isUnbound() || !readLazyValue(reader, reader.next(), member))
+          return false;
+      }
+      return true;
+    }
+
+    case JsonEvent::BeginArray: {
+      JsonArray array = dst.to<JsonArray>();
+      if (array.isNull())
+        return false;
+      while ((e = reader.next()) != JsonEvent::EndArray &&
+             e != JsonEvent::Error) {
+        JsonVariant element = array.add<JsonVariant>();
+        if (element.isUnbound() || !readLazyValue(reader, e, element))
+          return false;
+      }
+      return true;
+    }
+
+    case JsonEvent::String:
+      return dst.set(JsonString(reader.text(), reader.textLength()));
+
+    case JsonEvent::Number:
+      return dst.set(serialized(reader.text(), reader.textLength()));
+
+    case JsonEvent::Boolean:
+      return dst.set(reader.asBool());
+
+    case JsonEvent::Null:
+      return dst.set(nullptr);
+
+    default:  // Error
+      return true;
+  }
+}
+
+// Replaces the JSON number in [s, s + n) with its value: an integer if it
+// has no fraction nor exponent and fits, a float otherwise.
+// Returns false if the text isn't a number.
+inline bool storeNumber(JsonVariant variant, const char* s, size_t n) {
+  const char* end = s + n;
+  bool negative = s != end && *s == '-';
+  uint64_t magnitude;
+  const char* p = parseDigits(s + negative, end, magnitude);
+  if (p == end && p != s + negative) {
+    if (!negative && canConvertNumber<JsonUInt>(magnitude))
+      return variant.set(JsonUInt(magnitude));
+    if (negative && magnitude <= uint64_t(INT64_MAX) + 1) {
+      int64_t value = int64_t(0 - magnitude);
+      if (canConvertNumber<JsonInteger>(value))
+        return variant.set(JsonInteger(value));
+    }
+  }
+  double value = 0;
+  if (parseFloatFast(s, end, value) != end) {
+    char* strtodEnd;
+    value = strtod(s, &strtodEnd);  // more than 19 digits, close to a tie
+    if (strtodEnd != end)
+      return false;
+  }
+  return variant.set(JsonFloat(value));
+}
+
+// Receives, from serializeJson(), the text of a number too long for the buffer
+// of lazyAs(), and keeps an equivalent short form: the first significant
+// digits and a decimal exponent.
+// A nonzero digit beyond maxDigits is kept as a trailing 1, so the short form
+// rounds to the same double, except when more than 40 digits are needed to
+// tell on which side of a tie the value lies.
+class LongNumberWriter {
+ public:
+  static constexpr size_t maxDigits = 40;
+
+  // Enough for a sign, the digits, the trailing 1, and "e-2147483648"
+  static constexpr size_t bufferSize = maxDigits + 16;
+
+  LongNumberWriter()
+      : count_(0),
+        exponent_(0),
+        explicitExponent_(0),
+        part_(Integer),
+        negative_(false),
+        exponentNegative_(false),
+        sticky_(false) {}
+
+  size_t write(uint8_t c) {
+    if (c == '-') {
+      if (part_ == Exponent)
+        exponentNegative_ = true;
+      else
+        negative_ = true;
+    } else if (c == '.') {
+      part_ = Fraction;
+    } else if (c == 'e' || c == 'E') {
+      part_ = Exponent;
+    } else if (isdigit(char(c))) {
+      addDigit(uint8_t(c - '0'));
+    }
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    for (size_t i = 0; i < n; i++)
+      write(s[i]);
+    return n;
+  }
+
+  // Writes the short form, e.g. "-1234e-7", and returns its length
+  size_t format(char (&buffer)[bufferSize]) const {
+    size_t n = 0;
+    if (negative_)
+      buffer[n++] = '-';
+    for (size_t i = 0; i < count_; i++)
+      buffer[n++] = char('0' + digits_[i]);
+    int32_t exponent = exponent_;
+    if (sticky_) {
+      buffer[n++] = '1';
+      exponent--;
+    }
+    if (count_ == 0)
+      buffer[n++] = '0';
+    exponent += exponentNegative_ ? -int32_t(explicitExponent_)
+                                  : int32_t(explicitExponent_);
+    buffer[n++] = 'e';
+    uint32_t magnitude = uint32_t(exponent);
+    if (exponent < 0) {
+      buffer[n++] = '-';
+      magnitude = 0 - magnitude;
+    }
+    char* end = buffer + n + 10;
+    char* begin = end;
+    do {
+      *--begin = char('0' + magnitude % 10);
+      magnitude /= 10;
+    } while (magnitude);
+    for (; begin != end; begin++)
+      buffer[n++] = *begin;
+    buffer[n] = 0;
+    return n;
+  }
+
+ private:
+  void addDigit(uint8_t digit) {
+    if (part_ == Exponent) {
+      if (explicitExponent_ < 100000)  // way past the range of a double
+        explicitExponent_ = explicitExponent_ * 10 + digit;
+    } else if (count_ == 0 && digit == 0) {  // leading zero
+      if (part_ == Fraction)
+        exponent_--;
+    } else if (count_ < maxDigits) {
+      digits_[count_++] = digit;
+      if (part_ == Fraction)
+        exponent_--;
+    } else {
+      if (part_ == Integer)
+        exponent_++;
+      if (digit)
+        sticky_ = true;
+    }
+  }
+
+  enum Part : uint8_t { Integer, Fraction, Exponent };
+
+  uint8_t digits_[maxDigits];
+  size_t count_;
+  int32_t exponent_;  // of the last digit kept
+  uint32_t explicitExponent_;
+  Part part_;
+  bool negative_;
+  bool exponentNegative_;
+  bool sticky_;
+};
+
+// A serialized() value is the only kind that none of these types matches
+inline bool isRawValue(JsonVariant variant) {
+  return !variant.isNull() && !variant.is<bool>() &&
+         !variant.is<JsonString>() && !variant.is<JsonFloat>() &&
+         !variant.is<JsonObject>() && !variant.is<JsonArray>();
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Same as deserializeJson(), except that numbers are not converted: they
+// are stored as serialized() text, which lazyAs<T>() converts on first
+// access. This skips the conversion of the numbers that are never read, and
+// serializeJson() writes back their original text. It is not a faster
+// deserializeJson(): the tree is built through the public API, and each
+// number is copied into the document as text, which usually takes more
+// memory than its value.
+//
+//   char buffer[64];
+//   deserializeJsonLazy(doc, input, buffer);
+//   float temperature = lazyAs<float>(doc["temperature"]);
+//
+// Read numbers with lazyAs<T>() only: until it has converted a number,
+// as<T>() returns 0 and is<T>() returns false for every numeric T.
+// The buffer holds one key, string, or number at a time; a longer one fails
+// with NoMemory.
+template <typename TInput>
+DeserializationError deserializeJsonLazy(
+    JsonDocument& doc, TInput&& input, char* buffer, size_t bufferSize,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  auto reader = makeJsonReader(detail::forward<TInput>(input), buffer,
+                               bufferSize, nestingLimit);
+  bool ok = detail::readLazyValue(reader, reader.next(),
+                                  doc.to<JsonVariant>());
+  if (reader.error())
+    return reader.error();
+  return ok ? DeserializationError::Ok : DeserializationError::NoMemory;
+}
+
+template <typename TInput, size_t N>
+DeserializationError deserializeJsonLazy(
+    JsonDocument& doc, TInput&& input, char (&buffer)[N],
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return deserializeJsonLazy(doc, detail::forward<TInput>(input), buffer, N,
+                             nestingLimit);
+}
+
+// Returns the value as a T, like as<T>(), but first converts a number left
+// as text by deserializeJsonLazy(). The result is stored in place of the
+// text, so the conversion only happens once; from then on, serializeJson()
+// writes the number as it would any other.
+// A number of 63 chars or more is first reduced to its significant digits.
+template <typename T>
+T lazyAs(JsonVariant variant) {
+  if (detail::isRawValue(variant)) {
+    char text[64];
+    size_t n = serializeJson(variant, text, sizeof(text));
+    if (n < sizeof(text) - 1) {
+      detail::storeNumber(variant, text, n);
+    } else {
+      detail::LongNumberWriter writer;
+      serializeJson(variant, writer);
+      char shortText[detail::LongNumberWriter::bufferSize];
+      n = writer.format(shortText);
+      detail::storeNumber(variant, shortText, n);
+    }
+  }
+  return variant.as<T>();
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
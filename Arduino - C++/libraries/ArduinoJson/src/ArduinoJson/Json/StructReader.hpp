@@ -0,0 +1,238 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonReader.hpp>
+#include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Variant/Converter.hpp>
+
+#include <string.h>  // memcpy, strncmp
+
+// Size of the buffer that holds one key, string, or number while
+// deserializeStruct() parses; longer strings are truncated
+#ifndef ARDUINOJSON_STRUCT_BUFFER_SIZE
+#  define ARDUINOJSON_STRUCT_BUFFER_SIZE 64
+#endif
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Accepts any call to field(), to detect Converter<T>::bind()
+struct BindingProbe {
+  template <typename... Args>
+  void field(const char*, Args&&...) {}
+};
+
+template <typename T, typename = void>
+struct HasBinding : false_type {};
+
+template <typename T>
+struct HasBinding<T, void_t<decltype(Converter<T>::bind(
+                         declval<BindingProbe&>(), declval<T&>()))>>
+    : true_type {};
+
+// Fills a struct from the events of a JsonReader, through the fields
+// declared by Converter<T>::bind()
+template <typename TJsonReader>
+class StructReader {
+ public:
+  explicit StructReader(TJsonReader& reader) : reader_(reader) {}
+
+  // Reads the members of the object that just began, up to its end.
+  // Only the fields whose path starts with prefix are considered; the keys
+  // are matched against what follows.
+  template <typename T>
+  void readMembers(T& object, const char* prefix = "",
+                   size_t prefixLength = 0) {
+    while (reader_.next() == JsonEvent::Key) {
+      Matcher matcher(*this, prefix, prefixLength);
+      Converter<T>::bind(matcher, object);
+      if (matcher.state == Matcher::Descend) {
+        if (reader_.next() == JsonEvent::BeginObject)
+          readMembers(object, matcher.path, matcher.pathLength);
+        else
+          reader_.skip();
+      } else if (matcher.state == Matcher::NotFound) {
+        reader_.skip();
+      }
+    }
+  }
+
+  // Passed to Converter<T>::bind(); reads the value of the current key into
+  // the field that matches it
+  class Matcher {
+   public:
+    enum State { NotFound, Found, Descend };
+
+    Matcher(StructReader& reader, const char* prefix, size_t prefixLength)
+        : state(NotFound),
+          path(prefix),
+          pathLength(prefixLength),
+          reader_(reader) {}
+
+    template <typename T>
+    void field(const char* fieldPath, T& value) {
+      if (match(fieldPath))
+        reader_.readValue(reader_.reader_.next(), value);
+    }
+
+    template <typename T, size_t N, typename TCount>
+    void field(const char* fieldPath, T (&values)[N], TCount& count) {
+      if (match(fieldPath))
+        reader_.readArray(reader_.reader_.next(), values, count);
+    }
+
+    State state;
+    const char* path;  // of the object to descend into
+    size_t pathLength;
+
+   private:
+    bool match(const char* fieldPath) {
+      if (state != NotFound || strncmp(fieldPath, path, pathLength) != 0)
+        return false;
+      const char* rest = fieldPath + pathLength;
+      size_t keyLength = reader_.reader_.textLength();
+      if (strncmp(rest, reader_.reader_.text(), keyLength) != 0)
+        return false;
+      if (rest[keyLength] == 0) {
+        state = Found;
+        return true;
+      }
+      if (rest[keyLength] == '/') {  // "time/hour" when the key is "time"
+        state = Descend;
+        path = fieldPath;
+        pathLength += keyLength + 1;
+      }
+      return false;
+    }
+
+    StructReader& reader_;
+  };
+
+ private:
+  using Event = JsonEvent::Type;
+
+  template <typename T>
+  enable_if_t<HasBinding<T>::value> readValue(Event e, T& object) {
+    if (e == JsonEvent::BeginObject)
+      readMembers(object);
+    else
+      reader_.skip();
+  }
+
+  template <size_t N>
+  void readValue(Event e, char (&s)[N]) {
+    size_t n = 0;
+    if (e == JsonEvent::String || e == JsonEvent::Number) {
+      n = reader_.textLength() < N - 1 ? reader_.textLength() : N - 1;
+      memcpy(s, reader_.text(), n);
+    }
+    s[n] = 0;
+    reader_.skip();
+  }
+
+  template <typename T, size_t N>
+  void readValue(Event e, T (&values)[N]) {
+    size_t count;
+    readArray(e, values, count);
+  }
+
+  template <typename T>
+  enable_if_t<is_integral<T>::value && !is_same<T, bool>::value> readValue(
+      Event e, T& value) {
+    int64_t n = e == JsonEvent::Boolean ? reader_.asBool()
+                                        : reader_.asInteger();
+    value = canConvertNumber<T>(n) ? T(n) : 0;
+    reader_.skip();
+  }
+
+  template <typename T>
+  enable_if_t<is_floating_point<T>::value> readValue(Event e, T& value) {
+    value = e == JsonEvent::Boolean ? reader_.asBool()
+                                    : static_cast<T>(reader_.asDouble());
+    reader_.skip();
+  }
+
+  void readValue(Event e, bool& value) {
+    value = e == JsonEvent::Boolean ? reader_.asBool()
+                                    : reader_.asDouble() != 0;
+    reader_.skip();
+  }
+
+  // Fills values with the elements of the array; extra elements are skipped
+  template <typename T, size_t N, typename TCount>
+  void readArray(Event e, T (&values)[N], TCount& count) {
+    count = 0;
+    if (e != JsonEvent::BeginArray) {
+      reader_.skip();
+      return;
+    }
+    for (;;) {
+      e = reader_.next();
+      if (e == JsonEvent::EndArray || e == JsonEvent::Error)
+        return;
+      if (size_t(count) < N)
+        readValue(e, values[count++]);
+      else
+        reader_.skip();
+    }
+  }
+
+  TJsonReader& reader_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a JSON object straight into a struct, without a JsonDocument.
+// The fields are declared once, in a Converter with a bind() function:
+//
+//   struct Dose {
+//     char name[12];
+//     uint8_t hour, minute;
+//     uint8_t days[7];
+//     size_t dayCount;
+//   };
+//
+//   template <>
+//   struct Converter<Dose> {
+//     template <typename TBinder>
+//     static void bind(TBinder& b, Dose& dose) {
+//       b.field("name", dose.name);
+//       b.field("time/hour", dose.hour);  // path in nested objects
+//       b.field("time/minute", dose.minute);
+//       b.field("days", dose.days, dose.dayCount);
+//     }
+//   };
+//
+//   Dose dose;
+//   deserializeStruct(dose, input);
+//
+// A field can be a char array (the string is truncated to fit), a number, a
+// bool, a struct with its own bind(), or an array of those. Unknown members
+// are skipped; a field whose value has the wrong type gets 0 or "".
+// Memory use is sizeof(T), plus ARDUINOJSON_STRUCT_BUFFER_SIZE bytes for the
+// current token, plus one bit per nesting level.
+template <typename T, typename TInput>
+DeserializationError deserializeStruct(
+    T& dst, TInput&& input,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  static_assert(detail::HasBinding<T>::value,
+                "deserializeStruct() requires Converter<T>::bind()");
+  char buffer[ARDUINOJSON_STRUCT_BUFFER_SIZE];
+  auto reader =
+      makeJsonReader(detail::forward<TInput>(input), buffer, nestingLimit);
+  reader.allowTruncation(true);
+  detail::StructReader<decltype(reader)> structReader(reader);
+  JsonEvent::Type e = reader.next();
+  if (e == JsonEvent::BeginObject)
+    structReader.readMembers(dst);
+  else if (e != JsonEvent::Error)
+    return DeserializationError::InvalidInput;
+  return reader.error();
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
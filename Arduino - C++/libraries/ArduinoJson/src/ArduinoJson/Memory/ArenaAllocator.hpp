@@ -0,0 +1,176 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+
+#include <stdint.h>  // uint8_t, uintptr_t
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Strictest alignment of what the pools and strings contain
+union ArenaAlignment {
+  void* pointer;
+  double floating;
+  uint64_t integer;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// An allocator that carves blocks out of a caller-provided buffer and never
+// calls malloc().
+// Blocks are stacked: freeing or resizing the top block gives the memory
+// back, other blocks are marked free and reclaimed when everything above
+// them is freed. The whole buffer is recycled when no block is left, which
+// is what happens when a JsonDocument is cleared.
+// When the buffer is full, allocations fail and overflowed() returns true.
+class ArenaAllocator : public Allocator {
+ public:
+  ArenaAllocator(void* buffer, size_t capacity)
+      : buffer_(align(buffer)),
+        capacity_(alignedCapacity(buffer, capacity)),
+        top_(npos),
+        size_(0),
+        peak_(0),
+        overflowed_(false) {}
+
+  ArenaAllocator(const ArenaAllocator&) = delete;
+  ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+  void* allocate(size_t size) override {
+    size_t offset = size_;
+    if (!fits(offset, size))
+      return nullptr;
+    Header* block = header(offset);
+    block->size = padding(size);
+    block->previous = top_;
+    top_ = offset;
+    setSize(offset + sizeof(Header) + block->size);
+    return block + 1;
+  }
+
+  void deallocate(void* ptr) override {
+    if (!ptr)
+      return;
+    headerOf(ptr)->size |= freeFlag;
+    while (top_ != npos && (header(top_)->size & freeFlag)) {
+      size_ = top_;
+      top_ = header(top_)->previous;
+    }
+  }
+
+  void* reallocate(void* ptr, size_t newSize) override {
+    if (!ptr)
+      return allocate(newSize);
+    Header* block = headerOf(ptr);
+
+    // The top block grows or shrinks in place
+    if (offsetOf(block) == top_) {
+      if (!fits(top_, newSize))
+        return nullptr;
+      block->size = padding(newSize);
+      setSize(top_ + sizeof(Header) + block->size);
+      return ptr;
+    }
+
+    // Others keep their block when they shrink, and move when they grow
+    if (newSize <= block->size)
+      return ptr;
+    void* newPtr = allocate(newSize);
+    if (!newPtr)
+      return nullptr;
+    memcpy(newPtr, ptr, block->size);
+    block->size |= freeFlag;
+    return newPtr;
+  }
+
+  // Usable bytes, after aligning the buffer
+  size_t capacity() const {
+    return capacity_;
+  }
+
+  // Bytes in use, including the headers and the freed blocks that can't be
+  // reclaimed yet
+  size_t size() const {
+    return size_;
+  }
+
+  // Highest value of size() since the construction; use it to tune the
+  // buffer size
+  size_t peak() const {
+    return peak_;
+  }
+
+  // Returns true if an allocation failed
+  bool overflowed() const {
+    return overflowed_;
+  }
+
+ private:
+  // Aligned so that the block that follows is aligned too
+  struct alignas(detail::ArenaAlignment) Header {
+    size_t size;      // padded, so the lowest bit is free for freeFlag
+    size_t previous;  // offset of the block below, or npos
+  };
+
+  static constexpr size_t npos = size_t(-1);
+  static constexpr size_t freeFlag = 1;
+  static constexpr size_t alignment =
+      alignof(detail::ArenaAlignment) > 1 ? alignof(detail::ArenaAlignment) : 2;
+
+  static size_t padding(size_t bytes) {
+    return (bytes + alignment - 1) & ~(alignment - 1);
+  }
+
+  static uint8_t* align(void* buffer) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(buffer);
+    return reinterpret_cast<uint8_t*>(padding(address));
+  }
+
+  static size_t alignedCapacity(void* buffer, size_t capacity) {
+    size_t skipped = size_t(align(buffer) - static_cast<uint8_t*>(buffer));
+    return capacity > skipped ? capacity - skipped : 0;
+  }
+
+  bool fits(size_t offset, size_t size) {
+    size_t available = capacity_ - offset;
+    bool ok = available >= sizeof(Header) &&
+              size <= available - sizeof(Header) &&
+              padding(size) <= available - sizeof(Header);
+    if (!ok)
+      overflowed_ = true;
+    return ok;
+  }
+
+  void setSize(size_t size) {
+    size_ = size;
+    if (size > peak_)
+      peak_ = size;
+  }
+
+  Header* header(size_t offset) const {
+    return reinterpret_cast<Header*>(buffer_ + offset);
+  }
+
+  static Header* headerOf(void* ptr) {
+    return static_cast<Header*>(ptr) - 1;
+  }
+
+  size_t offsetOf(const Header* block) const {
+    return size_t(reinterpret_cast<const uint8_t*>(block) - buffer_);
+  }
+
+  uint8_t* buffer_;
+  size_t capacity_;
+  size_t top_;   // offset of the topmost block, or npos
+  size_t size_;  // offset of the first free byte
+  size_t peak_;
+  bool overflowed_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,520 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonReader.hpp>
+#include <ArduinoJson/MsgPack/MsgPackSerializer.hpp>
+#include <ArduinoJson/Numbers/parseFloatFast.hpp>
+#include <ArduinoJson/Polyfills/ctype.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Serialization/Writer.hpp>
+#include <ArduinoJson/Serialization/Writers/StaticStringWriter.hpp>
+#include <ArduinoJson/Strings/IsString.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <stdint.h>  // uint8_t
+#include <stdlib.h>  // strtod
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// The MessagePack counterpart of JsonTemplate: the shape of the message is
+// written in JSON, with a "?" at the position of each value.
+//
+//   MsgPackTemplate<2, 32> telemetry("{\"temperature\":?,\"humidity\":?}");
+//   telemetry.serialize(client, 21.5, 40);
+//
+// The constructor encodes the constant parts into a buffer of Capacity
+// bytes, so the text needn't outlive the template. serialize() then copies
+// them in one write each, and encodes the values like serializeMsgPack().
+// Unlike JsonTemplate, the text is parsed: the template is invalid if it
+// isn't valid JSON (with "?" at the positions of values), or if the constant
+// parts don't fit in Capacity bytes.
+template <size_t MaxPlaceholders, size_t Capacity>
+class MsgPackTemplate {
+  static_assert(MaxPlaceholders > 0, "MaxPlaceholders must be positive");
+
+ public:
+  explicit MsgPackTemplate(const char* json)
+      : size_(0), count_(0), valid_(json != nullptr) {
+    if (!valid_)
+      return;
+    valid_ = compileValue(json, 0) && *skipSpaces(json) == 0;
+  }
+
+  // Returns false if the text is null or invalid, if it has more than
+  // MaxPlaceholders, or if it needs more than Capacity bytes
+  bool valid() const {
+    return valid_;
+  }
+
+  size_t placeholders() const {
+    return count_;
+  }
+
+  // Number of bytes used in the buffer
+  size_t capacityUsed() const {
+    return size_;
+  }
+
+  // Writes the message to any destination supported by serializeMsgPack().
+  // Returns the number of bytes written, or 0 if the number of values
+  // doesn't match the number of placeholders.
+  template <typename TDestination, typename... TValues>
+  detail::enable_if_t<!detail::is_array<TDestination>::value, size_t>
+  serialize(TDestination& destination, const TValues&... values) const {
+    if (!valid_ || sizeof...(TValues) != count_)
+      return 0;
+    detail::Writer<TDestination> writer(destination);
+    return writeFrom(writer, 0, values...);
+  }
+
+  // Writes the message to a buffer, without a terminator
+  template <typename... TValues>
+  size_t serialize(void* buffer, size_t bufferSize,
+                   const TValues&... values) const {
+    if (!valid_ || sizeof...(TValues) != count_)
+      return 0;
+    detail::StaticStringWriter writer(reinterpret_cast<char*>(buffer),
+                                      bufferSize);
+    return writeFrom(writer, 0, values...);
+  }
+
+ private:
+  static const char* skipSpaces(const char* p) {
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+      p++;
+    return p;
+  }
+
+  // Counts the elements of the container that begins at p (after the
+  // opening bracket), without checking the syntax
+  static size_t countElements(const char* p) {
+    size_t commas = 0;
+    bool empty = true;
+    uint8_t depth = 0;
+    char quote = 0;  // inside a string?
+    for (; *p; p++) {
+      char c = *p;
+      if (quote) {
+        if (c == '\\' && p[1])
+          p++;
+        else if (c == quote)
+          quote = 0;
+        continue;
+      }
+      if (c == ']' || c == '}') {
+        if (depth == 0)
+          break;
+        depth--;
+      } else if (c == '[' || c == '{') {
+        depth++;
+      } else if (c == '"' || c == '\'') {
+        quote = c;
+      } else if (c == ',' && depth == 0) {
+        commas++;
+      }
+      if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+        empty = false;
+    }
+    return empty ? 0 : commas + 1;
+  }
+
+  bool compileValue(const char*& p, uint8_t depth) {
+    p = skipSpaces(p);
+    switch (*p) {
+      case '{':
+      case '[':
+        return compileContainer(p, depth);
+      case '"':
+      case '\'':
+        return compileString(p);
+      case '?':
+        p++;
+        if (count_ >= MaxPlaceholders)
+          return false;
+        offsets_[count_++] = size_;
+        return true;
+      case 't':
+        return compileLiteral(p, "true", 0xC3);
+      case 'f':
+        return compileLiteral(p, "false", 0xC2);
+      case 'n':
+        return compileLiteral(p, "null", 0xC0);
+      default:
+        return compileNumber(p);
+    }
+  }
+
+  bool compileContainer(const char*& p, uint8_t depth) {
+    if (depth >= ARDUINOJSON_DEFAULT_NESTING_LIMIT)
+      return false;
+    bool isObject = *p++ == '{';
+    size_t n = countElements(p);
+    if (isObject ? !putHeader(0x80, 0xDE, n) : !putHeader(0x90, 0xDC, n))
+      return false;
+    char close = isObject ? '}' : ']';
+    if (n == 0) {
+      p = skipSpaces(p);
+      return *p++ == close;
+    }
+    for (size_t i = 0; i < n; i++) {
+      if (isObject) {
+        p = skipSpaces(p);
+        if ((*p != '"' && *p != '\'') || !compileString(p))
+          return false;
+        p = skipSpaces(p);
+        if (*p++ != ':')
+          return false;
+      }
+      if (!compileValue(p, uint8_t(depth + 1)))
+        return false;
+      p = skipSpaces(p);
+      if (*p++ != (i + 1 < n ? ',' : close))
+        return false;
+    }
+    return true;
+  }
+
+  bool compileString(const char*& p) {
+    char quote = *p++;
+    const char* begin = p;
+    size_t length = 0;
+    if (!decodeString(p, quote, nullptr, length))  // measures
+      return false;
+    uint8_t header[5];
+    if (!putBytes(header, encodeStringHeader(header, length)))
+      return false;
+    if (length > Capacity - size_)
+      return false;
+    p = begin;
+    length = 0;
+    decodeString(p, quote, bytes_ + size_, length);
+    size_ += length;
+    return true;
+  }
+
+  // Decodes the string that ends with quote into out, or only counts the
+  // bytes if out is null
+  static bool decodeString(const char*& p, char quote, uint8_t* out,
+                           size_t& n) {
+    for (;;) {
+      char c = *p++;
+      if (c == 0)
+        return false;
+      if (c == quote)
+        return true;
+      if (c != '\\') {
+        emit(out, n, uint8_t(c));
+        continue;
+      }
+      c = *p++;
+      switch (c) {
+        case '"':
+        case '\'':
+        case '\\':
+        case '/':
+          emit(out, n, uint8_t(c));
+          break;
+        case 'b':
+          emit(out, n, '\b');
+          break;
+        case 'f':
+          emit(out, n, '\f');
+          break;
+        case 'n':
+          emit(out, n, '\n');
+          break;
+        case 'r':
+          emit(out, n, '\r');
+          break;
+        case 't':
+          emit(out, n, '\t');
+          break;
+        case 'u': {
+          long cp = readHex4(p);
+          if (cp >= 0xD800 && cp < 0xDC00 && p[0] == '\\' && p[1] == 'u') {
+            const char* q = p + 2;
+            long low = readHex4(q);
+            if (low >= 0xDC00 && low < 0xE000) {
+              cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+              p = q;
+            }
+          }
+          if (cp < 0)
+            return false;
+          emitUtf8(out, n, uint32_t(cp));
+          break;
+        }
+        default:
+          return false;
+      }
+    }
+  }
+
+  // Returns -1 if the four characters at p aren't hexadecimal digits
+  static long readHex4(const char*& p) {
+    long value = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+      char c = *p;
+      if (c >= '0' && c <= '9')
+        value = value * 16 + (c - '0');
+      else if (c >= 'a' && c <= 'f')
+        value = value * 16 + (c - 'a' + 10);
+      else if (c >= 'A' && c <= 'F')
+        value = value * 16 + (c - 'A' + 10);
+      else
+        return -1;
+      p++;
+    }
+    return value;
+  }
+
+  static void emit(uint8_t* out, size_t& n, uint8_t c) {
+    if (out)
+      out[n] = c;
+    n++;
+  }
+
+  static void emitUtf8(uint8_t* out, size_t& n, uint32_t cp) {
+    if (cp < 0x80) {
+      emit(out, n, uint8_t(cp));
+    } else if (cp < 0x800) {
+      emit(out, n, uint8_t(0xC0 | (cp >> 6)));
+      emit(out, n, uint8_t(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+      emit(out, n, uint8_t(0xE0 | (cp >> 12)));
+      emit(out, n, uint8_t(0x80 | ((cp >> 6) & 0x3F)));
+      emit(out, n, uint8_t(0x80 | (cp & 0x3F)));
+    } else {
+      emit(out, n, uint8_t(0xF0 | (cp >> 18)));
+      emit(out, n, uint8_t(0x80 | ((cp >> 12) & 0x3F)));
+      emit(out, n, uint8_t(0x80 | ((cp >> 6) & 0x3F)));
+      emit(out, n, uint8_t(0x80 | (cp & 0x3F)));
+    }
+  }
+
+  bool compileLiteral(const char*& p, const char* literal, uint8_t code) {
+    for (; *literal; literal++)
+      if (*p++ != *literal)
+        return false;
+    return put(code);
+  }
+
+  // Integers that fit take the smallest format, like in serializeMsgPack()
+  bool compileNumber(const char*& p) {
+    const char* begin = p;
+    while (isdigit(*p) || *p == '-' || *p == '+' || *p == '.' || *p == 'e' ||
+           *p == 'E')
+      p++;
+    if (!detail::isDecimalNumber(begin, p))
+      return false;
+    bool negative = *begin == '-';
+    uint64_t magnitude;
+    if (detail::parseDigits(begin + negative, p, magnitude) == p) {
+      uint8_t buffer[9];
+      if (!negative || magnitude <= uint64_t(INT64_MAX) + 1)
+        return putBytes(buffer, encodeInteger(buffer, magnitude, negative));
+    }
+    double value = 0;
+    if (detail::parseFloatFast(begin, p, value) != p) {
+      char* end;
+      value = strtod(begin, &end);  // more than 19 digits, close to a tie
+      if (end != p)
+        return false;
+    }
+    uint8_t buffer[9];
+    return putBytes(buffer, encodeFloat(buffer, value));
+  }
+
+  bool put(uint8_t c) {
+    if (size_ >= Capacity)
+      return false;
+    bytes_[size_++] = c;
+    return true;
+  }
+
+  bool putBigEndian(uint64_t value, uint8_t n) {
+    while (n--)
+      if (!put(uint8_t(value >> (n * 8))))
+        return false;
+    return true;
+  }
+
+  bool putHeader(uint8_t fixCode, uint8_t code16, size_t n) {
+    if (n < 16)
+      return put(uint8_t(fixCode | n));
+    if (n < 0x10000)
+      return put(code16) && putBigEndian(n, 2);
+    return put(uint8_t(code16 + 1)) && putBigEndian(n, 4);
+  }
+
+  bool putBytes(const uint8_t* p, size_t n) {
+    for (size_t i = 0; i < n; i++)
+      if (!put(p[i]))
+        return false;
+    return true;
+  }
+
+  // A double that a float holds exactly takes 5 bytes instead of 9, as in
+  // serializeMsgPack()
+  static size_t encodeFloat(uint8_t* out, double value) {
+    float value32 = float(value);
+    if (value32 == value) {
+      uint32_t bits;
+      memcpy(&bits, &value32, 4);
+      out[0] = 0xCA;
+      for (uint8_t i = 0; i < 4; i++)
+        out[1 + i] = uint8_t(bits >> (24 - i * 8));
+      return 5;
+    }
+    uint64_t bits;
+    memcpy(&bits, &value, 8);
+    out[0] = 0xCB;
+    for (uint8_t i = 0; i < 8; i++)
+      out[1 + i] = uint8_t(bits >> (56 - i * 8));
+    return 9;
+  }
+
+  // Integers take the smallest format, like in serializeMsgPack()
+  static size_t encodeInteger(uint8_t* out, uint64_t magnitude,
+                              bool negative) {
+    uint64_t bits = negative ? 0 - magnitude : magnitude;
+    uint8_t code;
+    if (negative) {
+      if (magnitude <= 32) {  // negative fixint
+        out[0] = uint8_t(bits);
+        return 1;
+      }
+      code = magnitude <= 0x80         ? 0xD0
+             : magnitude <= 0x8000     ? 0xD1
+             : magnitude <= 0x80000000 ? 0xD2
+                                       : 0xD3;
+    } else {
+      if (magnitude < 0x80) {  // positive fixint
+        out[0] = uint8_t(bits);
+        return 1;
+      }
+      code = magnitude < 0x100         ? 0xCC
+             : magnitude < 0x10000     ? 0xCD
+             : magnitude < 0x100000000 ? 0xCE
+                                       : 0xCF;
+    }
+    uint8_t n = uint8_t(1 << (code & 3));  // 1, 2, 4, or 8 bytes
+    out[0] = code;
+    for (uint8_t i = 0; i < n; i++)
+      out[1 + i] = uint8_t(bits >> ((n - 1 - i) * 8));
+    return size_t(1 + n);
+  }
+
+  static size_t encodeStringHeader(uint8_t* out, size_t length) {
+    if (length < 32) {
+      out[0] = uint8_t(0xA0 | length);
+      return 1;
+    }
+    uint8_t n = length < 0x100 ? 1 : length < 0x10000 ? 2 : 4;
+    out[0] = n == 1 ? 0xD9 : n == 2 ? 0xDA : 0xDB;
+    for (uint8_t i = 0; i < n; i++)
+      out[1 + i] = uint8_t(uint32_t(length) >> ((n - 1 - i) * 8));
+    return size_t(1 + n);
+  }
+
+  // Writes the fragment that precedes placeholder i (or ends the message)
+  template <typename TWriter>
+  size_t writeFragment(TWriter& writer, size_t i) const {
+    size_t begin = i == 0 ? 0 : offsets_[i - 1];
+    size_t end = i < count_ ? offsets_[i] : size_;
+    return writer.write(bytes_ + begin, end - begin);
+  }
+
+  template <typename TWriter>
+  size_t writeFrom(TWriter& writer, size_t i) const {
+    return writeFragment(writer, i);
+  }
+
+  template <typename TWriter, typename TValue, typename... TValues>
+  size_t writeFrom(TWriter& writer, size_t i, const TValue& value,
+                   const TValues&... values) const {
+    size_t n = writeFragment(writer, i);
+    n += writeValue(writer, value);
+    return n + writeFrom(writer, i + 1, values...);
+  }
+
+  template <typename TWriter, typename T>
+  static detail::enable_if_t<detail::is_integral<T>::value &&
+                                 !detail::is_same<T, bool>::value,
+                             size_t>
+  writeValue(TWriter& writer, T n) {
+    uint8_t buffer[9];
+    bool negative = n < 0;
+    uint64_t magnitude = negative ? 0 - uint64_t(n) : uint64_t(n);
+    return writer.write(buffer, encodeInteger(buffer, magnitude, negative));
+  }
+
+  template <typename TWriter, typename T>
+  static detail::enable_if_t<detail::is_floating_point<T>::value, size_t>
+  writeValue(TWriter& writer, T n) {
+    uint8_t buffer[9];
+    return writer.write(buffer, encodeFloat(buffer, double(n)));
+  }
+
+  template <typename TWriter>
+  static size_t writeValue(TWriter& writer, bool b) {
+    return writer.write(uint8_t(b ? 0xC3 : 0xC2));
+  }
+
+  template <typename TWriter>
+  static size_t writeValue(TWriter& writer, decltype(nullptr)) {
+    return writer.write(uint8_t(0xC0));
+  }
+
+  template <typename TWriter, typename TString>
+  static detail::enable_if_t<detail::IsString<TString>::value, size_t>
+  writeValue(TWriter& writer, const TString& s) {
+    auto adapted = detail::adaptString(s);
+    if (adapted.isNull())
+      return writer.write(uint8_t(0xC0));
+    uint8_t header[5];
+    size_t n = encodeStringHeader(header, adapted.size());
+    n = writer.write(header, n);
+    return n + writeChars(writer, adapted);
+  }
+
+  // A string in RAM is written in one piece, like the constant fragments
+  template <typename TWriter>
+  static size_t writeChars(TWriter& writer, detail::RamString s) {
+    return writer.write(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+  }
+
+  // Other strings, e.g. in flash, are copied through a small buffer
+  template <typename TWriter, typename TAdaptedString>
+  static size_t writeChars(TWriter& writer, TAdaptedString s) {
+    uint8_t buffer[32];
+    size_t n = 0;
+    for (size_t i = 0; i < s.size(); i += sizeof(buffer)) {
+      size_t chunk = s.size() - i;
+      if (chunk > sizeof(buffer))
+        chunk = sizeof(buffer);
+      for (size_t j = 0; j < chunk; j++)
+        buffer[j] = uint8_t(s[i + j]);
+      n += writer.write(buffer, chunk);
+    }
+    return n;
+  }
+
+  // A whole variant, e.g. a member of a document that was received earlier
+  template <typename TWriter>
+  static size_t writeValue(TWriter& writer, JsonVariantConst variant) {
+    return serializeMsgPack(variant, writer);
+  }
+
+  uint8_t bytes_[Capacity];
+  size_t offsets_[MaxPlaceholders];  // of each "?" in bytes_
+  size_t size_;
+  size_t count_;
+  bool valid_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
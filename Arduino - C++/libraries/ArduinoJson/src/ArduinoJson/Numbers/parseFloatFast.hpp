@@ -0,0 +1,249 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/PowersOfFive.hpp>
+#include <ArduinoJson/Polyfills/ctype.hpp>
+#include <ArduinoJson/Polyfills/pgmspace_generic.hpp>
+#include <ArduinoJson/Polyfills/wideMultiply.hpp>
+
+#include <float.h>   // FLT_EVAL_METHOD
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Layout of IEEE-754 binary formats, as needed by Eisel-Lemire
+template <typename T>
+struct BinaryFormat;
+
+template <>
+struct BinaryFormat<double> {
+  using bits_type = uint64_t;
+  static constexpr int mantissaBits = 52;
+  static constexpr int minExponent = -1023;
+  static constexpr int infinitePower = 0x7FF;
+  static constexpr int smallestPowerOfTen = -342;
+  static constexpr int largestPowerOfTen = 308;
+  static constexpr int minRoundToEven = -4;
+  static constexpr int maxRoundToEven = 23;
+  static constexpr int maxExactPowerOfTen = 22;
+  static constexpr uint64_t maxExactMantissa = uint64_t(1) << 53;
+
+  static double exactPowerOfTen(int e) {
+    ARDUINOJSON_DEFINE_PROGMEM_ARRAY(double, powers,
+                                     {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                      1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                      1e18, 1e19, 1e20, 1e21, 1e22});
+    return pgm_read(powers + e);
+  }
+};
+
+template <>
+struct BinaryFormat<float> {
+  using bits_type = uint32_t;
+  static constexpr int mantissaBits = 23;
+  static constexpr int minExponent = -127;
+  static constexpr int infinitePower = 0xFF;
+  static constexpr int smallestPowerOfTen = -65;
+  static constexpr int largestPowerOfTen = 38;
+  static constexpr int minRoundToEven = -17;
+  static constexpr int maxRoundToEven = 10;
+  static constexpr int maxExactPowerOfTen = 10;
+  static constexpr uint64_t maxExactMantissa = uint64_t(1) << 24;
+
+  static float exactPowerOfTen(int e) {
+    ARDUINOJSON_DEFINE_PROGMEM_ARRAY(float, powers,
+                                     {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                      1e6f, 1e7f, 1e8f, 1e9f, 1e10f});
+    return pgm_read(powers + e);
+  }
+};
+
+// Computes w * 10^q rounded to nearest, ties to even, and returns the raw bits
+// (without sign).
+// This is the Eisel-Lemire algorithm: with a correctly truncated 128-bit power
+// of five, the result is exact for any 64-bit w (Mushtak & Lemire, 2023).
+template <typename T>
+typename BinaryFormat<T>::bits_type eiselLemire(uint64_t w, int32_t q) {
+  using format = BinaryFormat<T>;
+  using bits_type = typename format::bits_type;
+  const int mantissaBits = format::mantissaBits;
+
+  if (w == 0 || q < format::smallestPowerOfTen)
+    return 0;
+  if (q > format::largestPowerOfTen)
+    return bits_type(format::infinitePower) << mantissaBits;
+
+  int lz = countLeadingZeros64(w);
+  w <<= lz;
+
+  // Only the first 64 bits of 5^q are needed unless the bits that matter for
+  // rounding are all ones
+  pgm_ptr<uint64_t> powersOfFive = PowersOfFive::table();
+  intptr_t index = 2 * (q - PowersOfFive::smallest);
+  Uint128 product = multiply64(w, powersOfFive[index]);
+  const uint64_t precisionMask = 0xFFFFFFFFFFFFFFFFULL >> (mantissaBits + 3);
+  if ((product.high & precisionMask) == precisionMask) {
+    Uint128 second = multiply64(w, powersOfFive[index + 1]);
+    product.low += second.high;
+    if (second.high > product.low)
+      product.high++;
+  }
+
+  int upperBit = int(product.high >> 63);
+  int shift = upperBit + 64 - mantissaBits - 3;
+  uint64_t mantissa = product.high >> shift;
+  // floor(log2(10^q)) + 63, valid for q in [-1233, 1233]
+  int32_t power2 = (((152170 + 65536) * q) >> 16) + 63 + upperBit - lz -
+                   format::minExponent;
+
+  if (power2 <= 0) {  // subnormal
+    if (-power2 + 1 >= 64)
+      return 0;
+    mantissa >>= -power2 + 1;
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    // Rounding may have carried us into the normal range
+    power2 = mantissa < (uint64_t(1) << mantissaBits) ? 0 : 1;
+    mantissa &= ~(uint64_t(1) << mantissaBits);
+    return bits_type((uint64_t(power2) << mantissaBits) | mantissa);
+  }
+
+  // Exactly halfway between two floats: round to even instead of up
+  if (product.low <= 1 && q >= format::minRoundToEven &&
+      q <= format::maxRoundToEven && (mantissa & 3) == 1 &&
+      (mantissa << shift) == product.high)
+    mantissa &= ~uint64_t(1);
+
+  mantissa += (mantissa & 1);
+  mantissa >>= 1;
+  if (mantissa >= (uint64_t(2) << mantissaBits)) {
+    mantissa = uint64_t(1) << mantissaBits;
+    power2++;
+  }
+  mantissa &= ~(uint64_t(1) << mantissaBits);
+
+  if (power2 >= format::infinitePower)
+    return bits_type(format::infinitePower) << mantissaBits;
+  return bits_type((uint64_t(power2) << mantissaBits) | mantissa);
+}
+
+template <typename T>
+T floatFromBits(typename BinaryFormat<T>::bits_type bits, bool negative) {
+  T value;
+  memcpy(&value, &bits, sizeof(value));
+  return negative ? -value : value;
+}
+
+// Converts w * 10^q to the nearest T.
+// When truncated is true, w only holds the first 19 significant digits: the
+// result is known only if rounding w and w+1 agree; otherwise, the function
+// returns false, and the caller must use a slower path.
+template <typename T>
+bool decimalToFloat(uint64_t w, int32_t q, bool truncated, bool negative,
+                    T& result) {
+  using format = BinaryFormat<T>;
+
+  // Clinger's fast path: both operands are exact, so is the single rounding.
+  // Skipped when the FPU keeps extra precision (x87), which would round twice.
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+  if (!truncated && w <= format::maxExactMantissa &&
+      q >= -format::maxExactPowerOfTen && q <= format::maxExactPowerOfTen) {
+    T value = T(w);
+    if (q < 0)
+      value = value / format::exactPowerOfTen(-q);
+    else
+      value = value * format::exactPowerOfTen(q);
+    result = negative ? -value : value;
+    return true;
+  }
+#endif
+
+  typename format::bits_type bits = eiselLemire<T>(w, q);
+  if (truncated && eiselLemire<T>(w + 1, q) != bits)
+    return false;
+
+  result = floatFromBits<T>(bits, negative);
+  return true;
+}
+
+// Parses a JSON number (optional minus, digits, optional fraction, optional
+// exponent) from [s, end) into a T.
+// Returns a pointer past the number, or nullptr if the input isn't a number or
+// if it has more than 19 significant digits and lies too close to a tie (the
+// caller must then use a slower path).
+template <typename T>
+const char* parseFloatFast(const char* s, const char* end, T& result) {
+  const int maxDigits = 19;  // fits in uint64_t
+
+  bool negative = false;
+  if (s != end && *s == '-') {
+    negative = true;
+    s++;
+  }
+
+  uint64_t mantissa = 0;
+  int32_t exponent = 0;
+  int digits = 0;
+  bool truncated = false;
+  bool hasDigits = false;
+
+  while (s != end && isdigit(*s)) {
+    hasDigits = true;
+    if (digits < maxDigits) {
+      mantissa = mantissa * 10 + uint64_t(*s - '0');
+      if (mantissa)
+        digits++;
+    } else {
+      exponent++;
+      truncated |= *s != '0';
+    }
+    s++;
+  }
+
+  if (s != end && *s == '.') {
+    s++;
+    while (s != end && isdigit(*s)) {
+      hasDigits = true;
+      if (digits < maxDigits) {
+        mantissa = mantissa * 10 + uint64_t(*s - '0');
+        if (mantissa)
+          digits++;
+        exponent--;
+      } else {
+        truncated |= *s != '0';
+      }
+      s++;
+    }
+  }
+
+  if (!hasDigits)
+    return nullptr;
+
+  if (s != end && (*s == 'e' || *s == 'E')) {
+    s++;
+    bool negativeExponent = false;
+    if (s != end && issign(*s)) {
+      negativeExponent = *s == '-';
+      s++;
+    }
+    if (s == end || !isdigit(*s))
+      return nullptr;
+    int32_t explicitExponent = 0;
+    while (s != end && isdigit(*s)) {
+      if (explicitExponent < 100000)  // anything beyond is zero or infinity
+        explicitExponent = explicitExponent * 10 + (*s - '0');
+      s++;
+    }
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+
+  if (!decimalToFloat(mantissa, exponent, truncated, negative, result))
+    return nullptr;
+  return s;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,238 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Patch/JsonPointer.hpp>
+#include <ArduinoJson/Variant/VariantAttorney.hpp>
+
+#include <string.h>  // memcmp
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+inline bool addValue(JsonVariant root, JsonString path,
+                     JsonVariantConst value) {
+  JsonPointerToken last;
+  bool isRoot;
+  JsonVariant parent = resolveParent(root, path, last, isRoot);
+  if (isRoot)
+    return root.set(value);
+
+  if (parent.is<JsonObject>()) {
+    JsonVariant existing = getChild(parent, last);
+    if (!existing.isUnbound())
+      return existing.set(value);
+    char buffer[ARDUINOJSON_JSON_POINTER_MAX_LENGTH];
+    JsonString key = last.decode(buffer, sizeof(buffer));
+    return !key.isNull() && parent[key].set(value);
+  }
+
+  if (parent.is<JsonArray>()) {
+    JsonArray array = parent.as<JsonArray>();
+    size_t size = array.size();
+    size_t index = size;
+    if (!last.isEnd() && (!last.toIndex(index) || index > size))
+      return false;
+    if (!array.add(nullptr))
+      return false;
+    // JsonArray has no insert(): shift the following elements
+    for (size_t i = size; i > index; i--)
+      if (!array[i].set(array[i - 1].as<JsonVariantConst>()))
+        return false;
+    return array[index].set(value);
+  }
+
+  return false;
+}
+
+inline bool removeValue(JsonVariant root, JsonString path) {
+  JsonPointerToken last;
+  bool isRoot;
+  JsonVariant parent = resolveParent(root, path, last, isRoot);
+
+  if (parent.is<JsonObject>()) {
+    JsonObject object = parent.as<JsonObject>();
+    for (JsonObject::iterator it = object.begin(); it != object.end(); ++it) {
+      if (last.equals(it->key())) {
+        object.remove(it);
+        return true;
+      }
+    }
+  } else if (parent.is<JsonArray>()) {
+    JsonArray array = parent.as<JsonArray>();
+    size_t index;
+    if (last.toIndex(index) && index < array.size()) {
+      array.remove(index);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Returns true if path designates a value inside the one at prefix
+inline bool isInside(JsonString path, JsonString prefix) {
+  return path.size() > prefix.size() && path.c_str()[prefix.size()] == '/' &&
+         memcmp(path.c_str(), prefix.c_str(), prefix.size()) == 0;
+}
+
+inline bool applyOperation(JsonVariant root, JsonObjectConst operation) {
+  JsonVariantConst op = operation["op"];
+  JsonString path = operation["path"];
+  JsonVariantConst value = operation["value"];
+  if (path.isNull())
+    return false;
+
+  if (op == "add")
+    return !value.isUnbound() && addValue(root, path, value);
+
+  if (op == "remove")
+    return removeValue(root, path);
+
+  if (op == "replace") {
+    JsonVariant target = resolvePointer(root, path);
+    return !value.isUnbound() && !target.isUnbound() && target.set(value);
+  }
+
+  if (op == "test") {
+    JsonVariant target = resolvePointer(root, path);
+    return !value.isUnbound() && !target.isUnbound() && target == value;
+  }
+
+  if (op == "move" || op == "copy") {
+    JsonString from = operation["from"];
+    JsonVariant source = from.isNull() ? JsonVariant()
+                                       : resolvePointer(root, from);
+    if (source.isUnbound())
+      return false;
+    // a value can't be moved into one of its children (RFC 6902, 4.4)
+    if (op == "move" && isInside(path, from))
+      return false;
+    // the source may move or be removed while we insert the copy; the copy
+    // comes from the same allocator, e.g. a FixedJsonDocument's arena
+    JsonDocument copy(VariantAttorney::getResourceManager(root)->allocator());
+    if (!copy.set(source))
+      return false;
+    if (op == "move" && !removeValue(root, from))
+      return false;
+    return addValue(root, path, copy);
+  }
+
+  return false;
+}
+
+inline bool diffJsonPatch(JsonArray patch, JsonPointerBuilder& path,
+                          JsonVariantConst from, JsonVariantConst to) {
+  if (from == to)
+    return true;
+
+  size_t size = path.size();
+
+  if (from.is<JsonObjectConst>() && to.is<JsonObjectConst>()) {
+    JsonObjectConst fromObject = from.as<JsonObjectConst>();
+    JsonObjectConst toObject = to.as<JsonObjectConst>();
+    for (JsonPairConst member : fromObject) {
+      if (!toObject[member.key()].isUnbound())
+        continue;
+      path.appendKey(member.key());
+      JsonObject operation = patch.add<JsonObject>();
+      if (!operation["op"].set("remove") ||
+          !operation["path"].set(path.c_str()))
+        return false;
+      path.truncate(size);
+    }
+    for (JsonPairConst member : toObject) {
+      JsonVariantConst previous = fromObject[member.key()];
+      path.appendKey(member.key());
+      if (previous.isUnbound()) {
+        JsonObject operation = patch.add<JsonObject>();
+        if (!operation["op"].set("add") ||
+            !operation["path"].set(path.c_str()) ||
+            !operation["value"].set(member.value()))
+          return false;
+      } else if (!diffJsonPatch(patch, path, previous, member.value())) {
+        return false;
+      }
+      path.truncate(size);
+    }
+    return !path.overflowed();
+  }
+
+  if (from.is<JsonArrayConst>() && to.is<JsonArrayConst>()) {
+    size_t fromSize = from.size(), toSize = to.size();
+    for (size_t i = 0; i < fromSize && i < toSize; i++) {
+      path.appendIndex(i);
+      if (!diffJsonPatch(patch, path, from[i], to[i]))
+        return false;
+      path.truncate(size);
+    }
+    for (size_t i = fromSize; i > toSize; i--) {  // last ones first
+      path.appendIndex(i - 1);
+      JsonObject operation = patch.add<JsonObject>();
+      if (!operation["op"].set("remove") ||
+          !operation["path"].set(path.c_str()))
+        return false;
+      path.truncate(size);
+    }
+    for (size_t i = fromSize; i < toSize; i++) {
+      path.appendIndex(i);
+      JsonObject operation = patch.add<JsonObject>();
+      if (!operation["op"].set("add") ||
+          !operation["path"].set(path.c_str()) ||
+          !operation["value"].set(to[i]))
+        return false;
+      path.truncate(size);
+    }
+    return !path.overflowed();
+  }
+
+  JsonObject operation = patch.add<JsonObject>();
+  return operation["op"].set("replace") &&
+         operation["path"].set(path.c_str()) &&
+         operation["value"].set(to) && !path.overflowed();
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Applies a JSON Patch (RFC 6902) in place.
+// Supports the six operations: add, remove, replace, move, copy, and test.
+//
+//   applyJsonPatch(doc, patch);
+//
+// Returns false if an operation fails (including a "test"), if the patch
+// is malformed, or if the document runs out of memory. The operations are
+// applied one by one, so the ones before the failure remain applied.
+inline bool applyJsonPatch(JsonVariant target, JsonVariantConst patch) {
+  if (target.isUnbound() || !patch.is<JsonArrayConst>())
+    return false;
+  for (JsonVariantConst operation : patch.as<JsonArrayConst>()) {
+    if (!detail::applyOperation(target, operation.as<JsonObjectConst>()))
+      return false;
+  }
+  return true;
+}
+
+// Writes the JSON Patch (RFC 6902) that turns `from` into `to`.
+// The patch uses "add", "remove", and "replace"; objects and arrays are
+// compared member by member and element by element, so a value moved
+// to another place is removed and added again.
+//
+//   JsonDocument patch;
+//   createJsonPatch(patch, previous, current);
+//
+// Returns false if the patch ran out of memory, or if a path is longer than
+// ARDUINOJSON_JSON_POINTER_MAX_LENGTH.
+inline bool createJsonPatch(JsonVariant patch, JsonVariantConst from,
+                            JsonVariantConst to) {
+  JsonArray operations = patch.to<JsonArray>();
+  if (operations.isNull())
+    return false;
+  detail::JsonPointerBuilder path;
+  return detail::diffJsonPatch(operations, path, from, to);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
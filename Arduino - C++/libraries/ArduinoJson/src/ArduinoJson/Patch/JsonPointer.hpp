@@ -0,0 +1,226 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArray.hpp>
+#include <ArduinoJson/Object/JsonObject.hpp>
+
+#include <stddef.h>  // size_t
+#include <string.h>  // memchr
+
+// Maximum length of a JSON Pointer built by createJsonPatch(), and of a
+// key containing "~0" or "~1" added by applyJsonPatch()
+#ifndef ARDUINOJSON_JSON_POINTER_MAX_LENGTH
+#  define ARDUINOJSON_JSON_POINTER_MAX_LENGTH 128
+#endif
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A reference token of a JSON Pointer (RFC 6901), still escaped
+class JsonPointerToken {
+ public:
+  JsonPointerToken() : data_(nullptr), size_(0) {}
+
+  JsonPointerToken(const char* data, size_t size) : data_(data), size_(size) {}
+
+  // "-" designates the position after the last element of an array
+  bool isEnd() const {
+    return size_ == 1 && data_[0] == '-';
+  }
+
+  // Array indexes are decimal, without leading zeros
+  bool toIndex(size_t& index) const {
+    if (size_ == 0 || (size_ > 1 && data_[0] == '0'))
+      return false;
+    index = 0;
+    for (size_t i = 0; i < size_; i++) {
+      if (data_[i] < '0' || data_[i] > '9')
+        return false;
+      size_t next = index * 10 + size_t(data_[i] - '0');
+      if (next < index)
+        return false;
+      index = next;
+    }
+    return true;
+  }
+
+  // Compares with a key, decoding "~0" and "~1" on the fly
+  bool equals(JsonString key) const {
+    size_t k = 0;
+    for (size_t i = 0; i < size_; i++, k++) {
+      char c = data_[i];
+      if (c == '~' && i + 1 < size_)
+        c = data_[++i] == '1' ? '/' : '~';
+      if (k >= key.size() || key.c_str()[k] != c)
+        return false;
+    }
+    return k == key.size();
+  }
+
+  // Returns the decoded key, using buffer only if the token has escapes.
+  // Returns null if the buffer is too small.
+  JsonString decode(char* buffer, size_t capacity) const {
+    if (!memchr(data_, '~', size_))
+      return JsonString(data_, size_);
+    size_t n = 0;
+    for (size_t i = 0; i < size_; i++, n++) {
+      if (n >= capacity)
+        return JsonString();
+      char c = data_[i];
+      if (c == '~' && i + 1 < size_)
+        c = data_[++i] == '1' ? '/' : '~';
+      buffer[n] = c;
+    }
+    return JsonString(buffer, n);
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+};
+
+// Splits a JSON Pointer into reference tokens
+class JsonPointerParser {
+ public:
+  JsonPointerParser(JsonString pointer)
+      : data_(pointer.c_str()), size_(pointer.size()), position_(0) {}
+
+  // The empty pointer designates the whole document
+  bool valid() const {
+    return size_ == 0 || data_[0] == '/';
+  }
+
+  bool next(JsonPointerToken& token) {
+    if (position_ >= size_)
+      return false;
+    size_t begin = ++position_;  // skip '/'
+    while (position_ < size_ && data_[position_] != '/')
+      position_++;
+    token = JsonPointerToken(data_ + begin, position_ - begin);
+    return true;
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t position_;
+};
+
+inline JsonVariant getChild(JsonVariant parent, const JsonPointerToken& token) {
+  if (parent.is<JsonObject>()) {
+    for (JsonPair member : parent.as<JsonObject>())
+      if (token.equals(member.key()))
+        return member.value();
+  } else if (parent.is<JsonArray>()) {
+    size_t index;
+    if (token.toIndex(index)) {
+      for (JsonVariant element : parent.as<JsonArray>())
+        if (index-- == 0)
+          return element;
+    }
+  }
+  return JsonVariant();
+}
+
+// Follows all the tokens but the last one, which is stored in `last`.
+// Returns an unbound variant if the path doesn't exist or designates the
+// root (in which case `isRoot` is set).
+inline JsonVariant resolveParent(JsonVariant root, JsonString pointer,
+                                 JsonPointerToken& last, bool& isRoot) {
+  JsonPointerParser parser(pointer);
+  isRoot = false;
+  if (!parser.valid())
+    return JsonVariant();
+  if (!parser.next(last)) {
+    isRoot = true;
+    return JsonVariant();
+  }
+  JsonVariant parent = root;
+  JsonPointerToken token;
+  while (parser.next(token)) {
+    parent = getChild(parent, last);
+    if (parent.isUnbound())
+      return parent;
+    last = token;
+  }
+  return parent;
+}
+
+inline JsonVariant resolvePointer(JsonVariant root, JsonString pointer) {
+  JsonPointerToken last;
+  bool isRoot;
+  JsonVariant parent = resolveParent(root, pointer, last, isRoot);
+  if (isRoot)
+    return root;
+  if (parent.isUnbound())
+    return parent;
+  return getChild(parent, last);
+}
+
+// Builds the JSON Pointers of createJsonPatch() in a fixed buffer
+class JsonPointerBuilder {
+ public:
+  JsonPointerBuilder() : size_(0), overflowed_(false) {
+    buffer_[0] = 0;
+  }
+
+  void appendKey(JsonString key) {
+    append('/');
+    for (size_t i = 0; i < key.size(); i++) {
+      char c = key.c_str()[i];
+      if (c == '~' || c == '/') {
+        append('~');
+        c = c == '~' ? '0' : '1';
+      }
+      append(c);
+    }
+  }
+
+  void appendIndex(size_t index) {
+    char digits[20];
+    size_t n = 0;
+    do {
+      digits[n++] = char('0' + index % 10);
+      index /= 10;
+    } while (index > 0);
+    append('/');
+    while (n > 0)
+      append(digits[--n]);
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  // Removes what was appended since size() returned `size`
+  void truncate(size_t size) {
+    size_ = size;
+    buffer_[size_] = 0;
+  }
+
+  const char* c_str() const {
+    return buffer_;
+  }
+
+  bool overflowed() const {
+    return overflowed_;
+  }
+
+ private:
+  void append(char c) {
+    if (size_ >= ARDUINOJSON_JSON_POINTER_MAX_LENGTH) {
+      overflowed_ = true;
+      return;
+    }
+    buffer_[size_++] = c;
+    buffer_[size_] = 0;
+  }
+
+  char buffer_[ARDUINOJSON_JSON_POINTER_MAX_LENGTH + 1];
+  size_t size_;
+  bool overflowed_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
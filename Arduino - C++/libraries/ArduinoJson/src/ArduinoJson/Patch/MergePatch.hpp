@@ -0,0 +1,85 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArray.hpp>
+#include <ArduinoJson/Object/JsonObject.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Applies a JSON Merge Patch (RFC 7386) in place.
+// Members of the patch replace the ones of the document, null members
+// remove them, and nested objects are merged recursively.
+//
+//   applyMergePatch(doc, patch);
+//
+// Returns false if the document ran out of memory; the patch is then
+// partially applied.
+inline bool applyMergePatch(JsonVariant target, JsonVariantConst patch) {
+  if (!patch.is<JsonObjectConst>())
+    return target.set(patch);
+  JsonObject object = target.is<JsonObject>() ? target.as<JsonObject>()
+                                               : target.to<JsonObject>();
+  if (object.isNull())
+    return false;
+  for (JsonPairConst member : patch.as<JsonObjectConst>()) {
+    JsonVariantConst value = member.value();
+    if (value.isNull()) {
+      object.remove(member.key());
+    } else if (value.is<JsonObjectConst>()) {
+      JsonObject child = object[member.key()].is<JsonObject>()
+                             ? object[member.key()].as<JsonObject>()
+                             : object[member.key()].to<JsonObject>();
+      if (child.isNull() || !applyMergePatch(child, value))
+        return false;
+    } else if (!object[member.key()].set(value)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Writes the JSON Merge Patch (RFC 7386) that turns `from` into `to`.
+// Only the members that changed are included; a document that didn't
+// change gives an empty object.
+//
+//   JsonDocument patch;
+//   createMergePatch(patch, previous, current);
+//
+// RFC 7386 can't express a member set to null (null means "remove"), nor
+// a change inside an array (the whole array is replaced).
+// Returns false if the patch ran out of memory.
+inline bool createMergePatch(JsonVariant patch, JsonVariantConst from,
+                             JsonVariantConst to) {
+  if (!from.is<JsonObjectConst>() || !to.is<JsonObjectConst>())
+    return patch.set(to);
+  JsonObject object = patch.to<JsonObject>();
+  if (object.isNull())
+    return false;
+  JsonObjectConst toObject = to.as<JsonObjectConst>();
+  for (JsonPairConst member : from.as<JsonObjectConst>()) {
+    if (toObject[member.key()].isNull() && !member.value().isNull() &&
+        !object[member.key()].set(nullptr))
+      return false;
+  }
+  JsonObjectConst fromObject = from.as<JsonObjectConst>();
+  for (JsonPairConst member : toObject) {
+    JsonVariantConst previous = fromObject[member.key()];
+    if (previous == member.value())
+      continue;
+    if (previous.is<JsonObjectConst>() &&
+        member.value().is<JsonObjectConst>()) {
+      JsonObject child = object[member.key()].to<JsonObject>();
+      if (child.isNull() ||
+          !createMergePatch(child, previous, member.value()))
+        return false;
+    } else if (!object[member.key()].set(member.value())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -29,6 +29,12 @@ inline uint32_t pgm_read(const uint32_t* p) {
   return pgm_read_dword(p);
 }
 
+inline uint64_t pgm_read(const uint64_t* p) {
+  uint64_t result;
+  memcpy_P(&result, p, sizeof(result));
+  return result;
+}
+
 inline double pgm_read(const double* p) {
   return pgm_read_double(p);
 }
@@ -0,0 +1,54 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <stdint.h>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+struct Uint128 {
+  uint64_t high;
+  uint64_t low;
+};
+
+// Full 64x64->128 bit product.
+// Uses the compiler's 128-bit integers when available (64-bit hosts), and
+// four 32x32 products otherwise (ESP32, AVR, MSVC).
+inline Uint128 multiply64(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+  __extension__ typedef unsigned __int128 uint128_t;
+  uint128_t r = uint128_t(a) * b;
+  return {uint64_t(r >> 64), uint64_t(r)};
+#else
+  uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+  uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+  uint64_t lolo = aLo * bLo;
+  uint64_t hilo = aHi * bLo;
+  uint64_t lohi = aLo * bHi;
+  uint64_t hihi = aHi * bHi;
+  uint64_t cross = (lolo >> 32) + (hilo & 0xFFFFFFFF) + lohi;
+  return {hihi + (hilo >> 32) + (cross >> 32),
+          (cross << 32) | (lolo & 0xFFFFFFFF)};
+#endif
+}
+
+inline int countLeadingZeros64(uint64_t x) {
+#if defined(__GNUC__)
+  return x ? __builtin_clzll(x) : 64;
+#else
+  int n = 0;
+  if (!x)
+    return 64;
+  while (!(x & 0x8000000000000000ULL)) {
+    x <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,101 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A Print that collects the output in a buffer and forwards it in chunks of
+// Capacity bytes.
+// serializeJson() writes one token at a time; on a WiFiClient, that's one
+// driver call, and sometimes one TCP segment or TLS record, per token.
+//
+//   BufferedPrint<256> buffered(client);
+//   serializeJson(doc, buffered);
+//   buffered.flush();  // or let the destructor do it
+//
+// If the target accepts fewer bytes than it's given, the output is truncated
+// and the following writes return 0. The counts returned before that include
+// bytes still in the buffer.
+template <size_t Capacity = 64>
+class BufferedPrint : public ::Print {
+  static_assert(Capacity > 0, "Capacity must be positive");
+
+ public:
+  explicit BufferedPrint(::Print& target)
+      : target_(&target), size_(0), failed_(false) {}
+
+  BufferedPrint(const BufferedPrint&) = delete;
+  BufferedPrint& operator=(const BufferedPrint&) = delete;
+
+  ~BufferedPrint() {
+    flush();
+  }
+
+  size_t write(uint8_t c) override {
+    if (failed_ || (size_ == Capacity && !flushBuffer()))
+      return 0;
+    buffer_[size_++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) override {
+    size_t written = 0;
+    while (n > 0 && !failed_) {
+      if (size_ == Capacity && !flushBuffer())
+        break;
+      if (size_ == 0 && n >= Capacity) {  // not worth copying
+        written += forward(s, n);
+        break;
+      }
+      size_t chunk = Capacity - size_ < n ? Capacity - size_ : n;
+      memcpy(buffer_ + size_, s, chunk);
+      size_ += chunk;
+      s += chunk;
+      n -= chunk;
+      written += chunk;
+    }
+    return written;
+  }
+
+  using ::Print::write;
+
+  // Sends the buffered bytes to the target
+  void flush() {
+    flushBuffer();
+  }
+
+  // Returns true if the target refused some bytes
+  bool failed() const {
+    return failed_;
+  }
+
+ private:
+  bool flushBuffer() {
+    if (failed_)
+      return false;
+    if (size_ > 0)
+      forward(buffer_, size_);
+    size_ = 0;
+    return !failed_;
+  }
+
+  size_t forward(const uint8_t* s, size_t n) {
+    size_t written = target_->write(s, n);
+    if (written < n)
+      failed_ = true;
+    return written;
+  }
+
+  ::Print* target_;
+  uint8_t buffer_[Capacity];
+  size_t size_;
+  bool failed_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,35 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// 32-bit FNV-1a: one XOR and one multiplication by 16777619 per byte
+inline uint32_t hashString(const char* s, size_t n) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < n; i++) {
+    hash ^= static_cast<uint8_t>(s[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Same as hashString() for adapted strings, which may live in flash
+template <typename TAdaptedString>
+inline uint32_t hashKey(const TAdaptedString& key) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < key.size(); i++) {
+    hash ^= static_cast<uint8_t>(key[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,230 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArrayConst.hpp>
+#include <ArduinoJson/Deserialization/Filter.hpp>
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Numbers/JsonFloat.hpp>
+#include <ArduinoJson/Numbers/JsonInteger.hpp>
+#include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Object/JsonObjectConst.hpp>
+
+#include <stdint.h>  // uint64_t
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+namespace HashOption {
+// Objects with the same members in a different order get the same hash
+struct IgnoreKeyOrder {};
+}  // namespace HashOption
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// 64-bit FNV-1a, fed byte by byte so the result doesn't depend on the
+// endianness of the platform.
+// It's also a writer, so serializeJson() can feed it the text of a value.
+class JsonHasher {
+ public:
+  enum Tag : uint8_t {
+    Null,
+    False,
+    True,
+    Integer,
+    UnsignedInteger,
+    Float,
+    String,
+    Array,
+    Object,
+    Member,
+    Raw,
+    Seed,
+  };
+
+  explicit JsonHasher(Tag tag) : hash_(0xcbf29ce484222325) {
+    add(static_cast<uint8_t>(tag));
+  }
+
+  JsonHasher& add(uint8_t c) {
+    hash_ ^= c;
+    hash_ *= 0x100000001b3;
+    return *this;
+  }
+
+  JsonHasher& add(uint64_t value) {
+    for (int i = 0; i < 8; i++, value >>= 8)
+      add(static_cast<uint8_t>(value));
+    return *this;
+  }
+
+  JsonHasher& add(JsonString s) {
+    for (size_t i = 0; i < s.size(); i++)
+      add(static_cast<uint8_t>(s.c_str()[i]));
+    return *this;
+  }
+
+  size_t write(uint8_t c) {
+    add(c);
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    for (size_t i = 0; i < n; i++)
+      add(s[i]);
+    return n;
+  }
+
+  uint64_t digest() const {
+    return hash_;
+  }
+
+ private:
+  uint64_t hash_;
+};
+
+template <typename TFilter>
+struct HashOptions {
+  TFilter filter;
+  bool ignoreKeyOrder;
+};
+
+inline HashOptions<AllowAllFilter> makeHashOptions() {
+  return {{}, false};
+}
+
+inline HashOptions<AllowAllFilter> makeHashOptions(
+    HashOption::IgnoreKeyOrder) {
+  return {{}, true};
+}
+
+template <typename TFilter>
+inline HashOptions<TFilter> makeHashOptions(TFilter filter) {
+  return {filter, false};
+}
+
+template <typename TFilter>
+inline HashOptions<TFilter> makeHashOptions(TFilter filter,
+                                            HashOption::IgnoreKeyOrder) {
+  return {filter, true};
+}
+
+template <typename TFilter>
+inline HashOptions<TFilter> makeHashOptions(HashOption::IgnoreKeyOrder,
+                                            TFilter filter) {
+  return {filter, true};
+}
+
+// Returns the hash of a subtree. Children are folded in by their own
+// digest, so [[1],2] and [[1,2]] don't produce the same stream of bytes.
+// Values rejected by the filter hash like null, which is what the
+// deserializer would store in their place.
+template <typename TFilter>
+uint64_t hashVariant(JsonVariantConst variant, TFilter filter,
+                     bool ignoreKeyOrder) {
+  if (variant.is<JsonObjectConst>() && filter.allowObject()) {
+    JsonHasher hasher(JsonHasher::Object);
+    uint64_t sum = 0;
+    for (JsonPairConst member : variant.as<JsonObjectConst>()) {
+      TFilter memberFilter = filter[member.key()];
+      if (!memberFilter.allow())
+        continue;
+      uint64_t memberHash =
+          JsonHasher(JsonHasher::Member)
+              .add(member.key())
+              .add(hashVariant(member.value(), memberFilter, ignoreKeyOrder))
+              .digest();
+      if (ignoreKeyOrder)
+        sum += memberHash;  // addition doesn't care about the order
+      else
+        hasher.add(memberHash);
+    }
+    if (ignoreKeyOrder)
+      hasher.add(sum);
+    return hasher.digest();
+  }
+
+  if (variant.is<JsonArrayConst>() && filter.allowArray()) {
+    JsonHasher hasher(JsonHasher::Array);
+    TFilter elementFilter = filter[0];
+    for (JsonVariantConst element : variant.as<JsonArrayConst>())
+      hasher.add(hashVariant(element, elementFilter, ignoreKeyOrder));
+    return hasher.digest();
+  }
+
+  if (variant.isNull() || !filter.allowValue() ||
+      variant.is<JsonObjectConst>() || variant.is<JsonArrayConst>())
+    return JsonHasher(JsonHasher::Null).digest();
+
+  if (variant.is<bool>())
+    return JsonHasher(variant.as<bool>() ? JsonHasher::True : JsonHasher::False)
+        .digest();
+
+  if (variant.is<JsonString>())
+    return JsonHasher(JsonHasher::String)
+        .add(variant.as<JsonString>())
+        .digest();
+
+  if (variant.is<JsonInteger>())
+    return JsonHasher(JsonHasher::Integer)
+        .add(static_cast<uint64_t>(variant.as<JsonInteger>()))
+        .digest();
+
+  if (variant.is<JsonUInt>())  // too large for JsonInteger
+    return JsonHasher(JsonHasher::UnsignedInteger)
+        .add(static_cast<uint64_t>(variant.as<JsonUInt>()))
+        .digest();
+
+  if (variant.is<JsonFloat>()) {
+    JsonFloat value = variant.as<JsonFloat>();
+    // 1.0 == 1, so they must hash the same (this also folds -0.0 into 0)
+    if (canConvertNumber<JsonInteger>(value) &&
+        static_cast<JsonFloat>(static_cast<JsonInteger>(value)) == value)
+      return JsonHasher(JsonHasher::Integer)
+          .add(static_cast<uint64_t>(static_cast<JsonInteger>(value)))
+          .digest();
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(value));
+    return JsonHasher(JsonHasher::Float).add(bits).digest();
+  }
+
+  // serialized() strings (and MessagePack binaries): hash the text that
+  // serializeJson() writes for them
+  JsonHasher hasher(JsonHasher::Raw);
+  serializeJson(variant, hasher);
+  return hasher.digest();
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Computes a 64-bit hash of the content of a variant, in one traversal and
+// without allocating.
+// Equal values (in the sense of operator==) get equal hashes, so this can
+// replace a serializeJson() + hash of the output when checking whether a
+// document changed. Like any hash, different values may collide.
+//
+//   hashJson(doc)
+//   hashJson(doc, seed, HashOption::IgnoreKeyOrder())
+//   hashJson(doc, seed, DeserializationOption::Filter(filter))
+//
+// With a filter, the members it rejects are skipped, so a timestamp or a
+// counter doesn't change the hash.
+template <typename... Args>
+uint64_t hashJson(JsonVariantConst source, uint64_t seed = 0,
+                  Args... args) {
+  auto options = detail::makeHashOptions(args...);
+  uint64_t hash =
+      detail::hashVariant(source, options.filter, options.ignoreKeyOrder);
+  return detail::JsonHasher(detail::JsonHasher::Seed)
+      .add(seed)
+      .add(hash)
+      .digest();
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
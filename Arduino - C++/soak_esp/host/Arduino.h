@@ -0,0 +1,219 @@
+#pragma once
+
+// -----------------------------------------------------
+// Núcleo de Arduino-ESP32 simulado para correr el sketch en la PC
+/*
+	Solo lo que usa Codigo_esp. El reloj es virtual (lo avanza el soak test), Serial imprime
+	en stdout si se pidió modo detallado y Serial2 es un buffer que el test llena con las
+	líneas que mandaría el UNO. Las tareas de FreeRTOS no existen: el test corre netLoop()
+	y linkStep() en el mismo hilo.
+*/
+// -----------------------------------------------------
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "WString.h"
+
+#define ARDUINO 10819
+#define ARDUINO_H_INCLUDED 1
+
+typedef bool boolean;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+class Print;
+
+class Printable {
+ public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print& p) const = 0;
+};
+
+class IPAddress {
+ public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes_{a, b, c, d} {}
+  String toString() const {
+    char b[16];
+    snprintf(b, sizeof(b), "%u.%u.%u.%u", bytes_[0], bytes_[1], bytes_[2], bytes_[3]);
+    return String(b);
+  }
+
+ private:
+  uint8_t bytes_[4] = {0, 0, 0, 0};
+};
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+
+  size_t write(const char* str) {
+    return str ? write((const uint8_t*)str, strlen(str)) : 0;
+  }
+  size_t write(const char* buffer, size_t size) {
+    return write((const uint8_t*)buffer, size);
+  }
+
+  size_t print(const char* s) {
+    return write(s);
+  }
+  size_t print(const String& s) {
+    return write(s.c_str(), s.length());
+  }
+  size_t print(char c) {
+    return write((uint8_t)c);
+  }
+  size_t print(int v) {
+    return print((long)v);
+  }
+  size_t print(unsigned v) {
+    return print((unsigned long)v);
+  }
+  size_t print(long v) {
+    char b[24];
+    return write(b, snprintf(b, sizeof(b), "%ld", v));
+  }
+  size_t print(unsigned long v) {
+    char b[24];
+    return write(b, snprintf(b, sizeof(b), "%lu", v));
+  }
+  size_t print(const IPAddress& ip) {
+    return print(ip.toString());
+  }
+  size_t print(const Printable& p) {
+    return p.printTo(*this);
+  }
+
+  size_t println() {
+    return write("\r\n");
+  }
+  template <typename T>
+  size_t println(const T& v) {
+    size_t n = print(v);
+    return n + println();
+  }
+
+  // Igual que Print::printf del core: buffer en la pila y malloc si no alcanza
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char loc[64];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(loc, sizeof(loc), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    if ((size_t)len < sizeof(loc)) return write(loc, len);
+
+    char* temp = (char*)malloc(len + 1);
+    if (!temp) return 0;
+    va_start(args, format);
+    vsnprintf(temp, len + 1, format, args);
+    va_end(args);
+    size_t n = write(temp, len);
+    free(temp);
+    return n;
+  }
+
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t n = 0;
+    while (n < length) {
+      int c = read();
+      if (c < 0) break;
+      buffer[n++] = (char)c;
+    }
+    return n;
+  }
+  size_t readBytes(uint8_t* buffer, size_t length) {
+    return readBytes((char*)buffer, length);
+  }
+  void setTimeout(unsigned long) {}
+};
+
+#define SERIAL_8N1 0x800001c
+
+// Serial: consola (stdout en modo detallado). Serial2: UART con el UNO simulado.
+class HardwareSerial : public Stream {
+ public:
+  explicit HardwareSerial(bool console) : console_(console) {}
+
+  void begin(unsigned long, uint32_t = SERIAL_8N1, int8_t = -1, int8_t = -1) {}
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+
+  int available() override;
+  int read() override;
+  int peek() override;
+
+  // Encola bytes como si los hubiera mandado el otro extremo
+  void inject(const char* data);
+
+  size_t txBytes() const {
+    return txBytes_;
+  }
+
+ private:
+  bool console_;
+  char rx_[256];
+  size_t rxHead_ = 0;
+  size_t rxLen_ = 0;
+  size_t txBytes_ = 0;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+class EspClass {
+ public:
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getHeapSize();
+};
+
+extern EspClass ESP;
+
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server1,
+                const char* server2 = nullptr, const char* server3 = nullptr);
+uint32_t esp_random();
+
+// ====== FreeRTOS (solo lo que usa el sketch) ======
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdPASS 1
+
+void vTaskDelay(TickType_t ticks);
+void vTaskDelete(TaskHandle_t task);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack,
+                                   void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core);
+
+#include "HostHooks.h"
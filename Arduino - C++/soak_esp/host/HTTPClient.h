@@ -0,0 +1,29 @@
+#pragma once
+
+#include <WiFiClientSecure.h>
+
+// Igual que el HTTPClient del core: separa la URL en Strings y junta cabeceras en otro
+class HTTPClient {
+ public:
+  ~HTTPClient() {
+    end();
+  }
+
+  bool begin(WiFiClient& client, const String& url);
+  void setTimeout(uint16_t) {}
+  void addHeader(const String& name, const String& value);
+  int GET();
+  int POST(const String& payload);
+  String getString();
+  void end();
+
+ private:
+  int sendRequest(const char* method, const String* payload);
+
+  WiFiClient* client_ = nullptr;
+  String url_;
+  String host_;
+  String uri_;
+  String headers_;
+  String response_;
+};
@@ -0,0 +1,243 @@
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+
+#include "SimHeap.h"
+
+HardwareSerial Serial(true);
+HardwareSerial Serial2(false);
+EspClass ESP;
+WiFiClass WiFi;
+
+uint32_t hostEpochAtBoot = 1760000000;  // 2025-10-09
+bool hostVerbose = false;
+
+// ====== Reloj virtual ======
+static uint64_t g_nowUs = 0;
+
+void hostAdvanceMs(uint32_t ms) {
+  g_nowUs += (uint64_t)ms * 1000;
+}
+
+unsigned long millis() {
+  return (unsigned long)(uint32_t)(g_nowUs / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(uint32_t)g_nowUs;
+}
+
+void delay(unsigned long ms) {
+  hostAdvanceMs(ms);
+}
+
+void vTaskDelay(TickType_t ticks) {
+  hostAdvanceMs(ticks);
+  hostYield();
+}
+
+void vTaskDelete(TaskHandle_t) {}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*,
+                                   UBaseType_t, TaskHandle_t*, BaseType_t) {
+  return pdPASS;  // El soak test llama a netLoop() directamente
+}
+
+static long g_gmtOffsetSec = 0;
+
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char*, const char*, const char*) {
+  g_gmtOffsetSec = gmtOffsetSec + daylightOffsetSec;
+}
+
+bool getLocalTime(struct tm* info, uint32_t) {
+  time_t t = (time_t)hostEpochAtBoot + (time_t)(g_nowUs / 1000000) + g_gmtOffsetSec;
+  gmtime_r(&t, info);
+  return true;
+}
+
+uint32_t esp_random() {
+  static uint32_t state = 0x9E3779B9u;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+// ====== Serial ======
+size_t HardwareSerial::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  txBytes_ += size;
+  if (console_ && hostVerbose) fwrite(buffer, 1, size, stdout);
+  return size;
+}
+
+int HardwareSerial::available() {
+  return (int)rxLen_;
+}
+
+int HardwareSerial::read() {
+  if (rxLen_ == 0) return -1;
+  char c = rx_[rxHead_];
+  rxHead_ = (rxHead_ + 1) % sizeof(rx_);
+  rxLen_--;
+  return (uint8_t)c;
+}
+
+int HardwareSerial::peek() {
+  return rxLen_ ? (uint8_t)rx_[rxHead_] : -1;
+}
+
+void HardwareSerial::inject(const char* data) {
+  // Como la UART real: si el buffer está lleno se pierden bytes
+  for (; *data && rxLen_ < sizeof(rx_); data++) {
+    rx_[(rxHead_ + rxLen_) % sizeof(rx_)] = *data;
+    rxLen_++;
+  }
+}
+
+// ====== ESP ======
+uint32_t EspClass::getFreeHeap() {
+  return simHeapStats().freeBytes;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+  return simHeapStats().minFreeBytes;
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  return simHeapStats().largestFreeBlock;
+}
+
+uint32_t EspClass::getHeapSize() {
+  return SIM_HEAP_SIZE;
+}
+
+// ====== Clientes TCP/TLS ======
+// Tamaños aproximados de lo que reserva mbedTLS por conexión en Arduino-ESP32
+static const size_t TLS_CTX_SIZE = 1800;
+static const size_t TLS_IN_BUF_SIZE = 16 * 1024 + 325;
+static const size_t TLS_OUT_BUF_SIZE = 4 * 1024 + 325;
+
+int WiFiClient::connect(const char*, uint16_t) {
+  return 0;
+}
+
+void WiFiClient::stop() {
+  free(ctx_);
+  ctx_ = nullptr;
+}
+
+int WiFiClientSecure::connect(const char*, uint16_t) {
+  stop();
+  if (!hostWifiUp()) return 0;
+
+  ctx_ = malloc(TLS_CTX_SIZE);
+  inBuf_ = malloc(TLS_IN_BUF_SIZE);
+  outBuf_ = malloc(TLS_OUT_BUF_SIZE);
+  hostAdvanceMs(350);  // Handshake
+
+  if (!ctx_ || !inBuf_ || !outBuf_ || !hostTlsConnect()) {
+    stop();
+    return 0;
+  }
+  return 1;
+}
+
+void WiFiClientSecure::stop() {
+  free(inBuf_);
+  free(outBuf_);
+  inBuf_ = outBuf_ = nullptr;
+  WiFiClient::stop();
+}
+
+// ====== HTTPClient ======
+bool HTTPClient::begin(WiFiClient& client, const String& url) {
+  client_ = &client;
+  url_ = url;
+
+  // https://host/uri
+  int start = url.startsWith("https://") ? 8 : 0;
+  String rest = url.substring(start);
+  int slash = rest.indexOf('/');
+  host_ = rest.substring(0, slash);
+  uri_ = rest.substring(slash);
+  return true;
+}
+
+void HTTPClient::addHeader(const String& name, const String& value) {
+  headers_ += name;
+  headers_ += ": ";
+  headers_ += value;
+  headers_ += "\r\n";
+}
+
+int HTTPClient::sendRequest(const char* method, const String* payload) {
+  if (!client_ || !client_->connected()) return -1;  // HTTPC_ERROR_CONNECTION_REFUSED
+
+  // La cabecera se arma en un String antes de mandarla
+  String header = String(method) + " " + uri_ + " HTTP/1.1\r\nHost: " + host_ + "\r\n";
+  header += headers_;
+  header += "\r\n";
+  client_->write(header.c_str(), header.length());
+  if (payload) client_->write(payload->c_str(), payload->length());
+
+  hostAdvanceMs(200);
+  return hostHttpRequest(method, url_, payload, response_);
+}
+
+int HTTPClient::GET() {
+  return sendRequest("GET", nullptr);
+}
+
+int HTTPClient::POST(const String& payload) {
+  return sendRequest("POST", &payload);
+}
+
+String HTTPClient::getString() {
+  // El core reserva el largo de la respuesta y copia el stream en un String nuevo
+  String out;
+  out.reserve(response_.length());
+  out.concat(response_);
+  return out;
+}
+
+void HTTPClient::end() {
+  url_ = String();
+  host_ = String();
+  uri_ = String();
+  headers_ = String();
+  response_ = String();
+  if (client_) client_->stop();
+  client_ = nullptr;
+}
+
+// ====== Preferences ======
+Preferences::Entry* Preferences::find(const char* key) {
+  for (uint8_t i = 0; i < MAX_ENTRIES; i++) {
+    if (strcmp(entries_[i].key, key) == 0) return &entries_[i];
+  }
+  return nullptr;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  if (len > sizeof(Entry::data) || strlen(key) >= sizeof(Entry::key)) return 0;
+  Entry* e = find(key);
+  if (!e) e = find("");
+  if (!e) return 0;
+  strcpy(e->key, key);
+  memcpy(e->data, value, len);
+  e->len = len;
+  return len;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  Entry* e = find(key);
+  if (!e || e->len > maxLen) return 0;
+  memcpy(buf, e->data, e->len);
+  return e->len;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+class String;
+
+// -----------------------------------------------------
+// Puntos donde el soak test maneja el entorno simulado
+// (los define soak_test.cpp; los shims solo los llaman)
+// -----------------------------------------------------
+
+// Respuesta HTTP de Firestore: devuelve el código y deja el body en response
+int hostHttpRequest(const char* method, const String& url, const String* body, String& response);
+
+// false simula que el handshake TLS falló
+bool hostTlsConnect();
+
+// Estado del enlace WiFi simulado
+bool hostWifiUp();
+
+// Lo que haría linkTask mientras netTask espera (una vuelta de linkStep())
+void hostYield();
+
+// Avanza el reloj virtual
+void hostAdvanceMs(uint32_t ms);
+
+// Epoch UTC que corresponde a millis() == 0
+extern uint32_t hostEpochAtBoot;
+
+// true: Serial se imprime en stdout
+extern bool hostVerbose;
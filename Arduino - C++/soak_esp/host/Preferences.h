@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// NVS simulada: unas pocas claves en memoria estática (no usa el heap)
+class Preferences {
+ public:
+  bool begin(const char*, bool = false) {
+    return true;
+  }
+  void end() {}
+  size_t putBytes(const char* key, const void* value, size_t len);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+
+ private:
+  struct Entry {
+    char key[16];
+    uint8_t data[1024];
+    size_t len;
+  };
+  static const uint8_t MAX_ENTRIES = 4;
+
+  Entry* find(const char* key);
+
+  Entry entries_[MAX_ENTRIES] = {};
+};
@@ -0,0 +1,303 @@
+#include "SimHeap.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include "esp_heap_caps.h"
+
+// Cada bloque lleva una cabecera con su tamaño y el del vecino anterior (para unir al liberar).
+// Los libres además guardan la lista doble, ordenada por dirección.
+namespace {
+
+const size_t ALIGN = 16;
+const size_t USED = 1;
+
+struct Block {
+  size_t size;      // Bytes del bloque con cabecera; bit 0 = en uso
+  size_t prevSize;  // Tamaño del bloque físico anterior (0 en el primero)
+};
+
+struct FreeBlock {
+  Block hdr;
+  FreeBlock* next;
+  FreeBlock* prev;
+};
+
+const size_t HEADER = sizeof(Block);
+const size_t MIN_BLOCK = (sizeof(FreeBlock) + ALIGN - 1) & ~(ALIGN - 1);
+
+alignas(ALIGN) unsigned char g_arena[SIM_HEAP_SIZE];
+FreeBlock* g_freeList = nullptr;
+bool g_ready = false;
+
+size_t g_freeBytes = 0;
+size_t g_minFreeBytes = 0;
+size_t g_usedBlocks = 0;
+size_t g_freeBlocks = 0;
+uint64_t g_allocCalls = 0;
+uint64_t g_failedAllocs = 0;
+
+size_t blockSize(const Block* b) {
+  return b->size & ~USED;
+}
+
+bool isUsed(const Block* b) {
+  return b->size & USED;
+}
+
+Block* nextBlock(Block* b) {
+  return (Block*)((unsigned char*)b + blockSize(b));
+}
+
+Block* prevBlock(Block* b) {
+  return b->prevSize ? (Block*)((unsigned char*)b - b->prevSize) : nullptr;
+}
+
+void* payload(Block* b) {
+  return (unsigned char*)b + HEADER;
+}
+
+Block* header(void* p) {
+  return (Block*)((unsigned char*)p - HEADER);
+}
+
+void listInsert(FreeBlock* f) {
+  FreeBlock* prev = nullptr;
+  FreeBlock* cur = g_freeList;
+  while (cur && cur < f) {
+    prev = cur;
+    cur = cur->next;
+  }
+  f->prev = prev;
+  f->next = cur;
+  if (cur) cur->prev = f;
+  if (prev) {
+    prev->next = f;
+  } else {
+    g_freeList = f;
+  }
+  g_freeBlocks++;
+}
+
+void listRemove(FreeBlock* f) {
+  if (f->prev) {
+    f->prev->next = f->next;
+  } else {
+    g_freeList = f->next;
+  }
+  if (f->next) f->next->prev = f->prev;
+  g_freeBlocks--;
+}
+
+// Ocupa el bloque libre f con need bytes; el sobrante queda libre en su lugar de la lista
+void carve(FreeBlock* f, size_t need) {
+  size_t size = blockSize(&f->hdr);
+  FreeBlock* next = f->next;
+  FreeBlock* prev = f->prev;
+  listRemove(f);
+
+  if (size - need >= MIN_BLOCK) {
+    FreeBlock* rest = (FreeBlock*)((unsigned char*)f + need);
+    rest->hdr.size = size - need;
+    rest->hdr.prevSize = need;
+    nextBlock(&rest->hdr)->prevSize = size - need;
+    rest->prev = prev;
+    rest->next = next;
+    if (next) next->prev = rest;
+    if (prev) {
+      prev->next = rest;
+    } else {
+      g_freeList = rest;
+    }
+    g_freeBlocks++;
+    size = need;
+  }
+
+  f->hdr.size = size | USED;
+  g_freeBytes -= size;
+  if (g_freeBytes < g_minFreeBytes) g_minFreeBytes = g_freeBytes;
+  g_usedBlocks++;
+}
+
+// Libera b uniéndolo con los vecinos físicos libres
+void release(Block* b) {
+  size_t size = blockSize(b);
+  b->size = size;
+  g_freeBytes += size;
+  g_usedBlocks--;
+
+  Block* next = nextBlock(b);
+  if (!isUsed(next)) {
+    listRemove((FreeBlock*)next);
+    size += blockSize(next);
+    b->size = size;
+    nextBlock(b)->prevSize = size;
+  }
+
+  Block* prev = prevBlock(b);
+  if (prev && !isUsed(prev)) {
+    prev->size = blockSize(prev) + size;
+    nextBlock(prev)->prevSize = prev->size;
+    return;  // prev ya estaba en la lista
+  }
+
+  listInsert((FreeBlock*)b);
+}
+
+void init() {
+  // Un bloque libre con todo y un centinela ocupado de tamaño 0 al final
+  size_t size = SIM_HEAP_SIZE - HEADER;
+  FreeBlock* first = (FreeBlock*)g_arena;
+  first->hdr.size = size;
+  first->hdr.prevSize = 0;
+  first->next = first->prev = nullptr;
+
+  Block* end = (Block*)(g_arena + size);
+  end->size = USED;
+  end->prevSize = size;
+
+  g_freeList = first;
+  g_freeBlocks = 1;
+  g_freeBytes = g_minFreeBytes = size;
+  g_ready = true;
+}
+
+size_t requestSize(size_t n) {
+  if (n > SIM_HEAP_SIZE) return 0;
+  size_t need = (n + HEADER + ALIGN - 1) & ~(ALIGN - 1);
+  return need < MIN_BLOCK ? MIN_BLOCK : need;
+}
+
+void* allocate(size_t n) {
+  if (!g_ready) init();
+  g_allocCalls++;
+
+  size_t need = requestSize(n);
+  if (need) {
+    for (FreeBlock* f = g_freeList; f; f = f->next) {
+      if (blockSize(&f->hdr) >= need) {
+        carve(f, need);
+        return payload(&f->hdr);
+      }
+    }
+  }
+
+  g_failedAllocs++;
+  return nullptr;
+}
+
+}  // namespace
+
+SimHeapStats simHeapStats() {
+  if (!g_ready) init();
+
+  SimHeapStats s = {};
+  s.freeBytes = g_freeBytes;
+  s.minFreeBytes = g_minFreeBytes;
+  s.allocatedBlocks = g_usedBlocks;
+  s.freeBlocks = g_freeBlocks;
+  s.allocCalls = g_allocCalls;
+  s.failedAllocs = g_failedAllocs;
+  for (FreeBlock* f = g_freeList; f; f = f->next) {
+    size_t usable = blockSize(&f->hdr) - HEADER;
+    if (usable > s.largestFreeBlock) s.largestFreeBlock = usable;
+  }
+  return s;
+}
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t) {
+  SimHeapStats s = simHeapStats();
+  info->total_free_bytes = s.freeBytes;
+  info->total_allocated_bytes = SIM_HEAP_SIZE - s.freeBytes;
+  info->largest_free_block = s.largestFreeBlock;
+  info->minimum_free_bytes = s.minFreeBytes;
+  info->allocated_blocks = s.allocatedBlocks;
+  info->free_blocks = s.freeBlocks;
+  info->total_blocks = s.allocatedBlocks + s.freeBlocks;
+}
+
+// ====== Reemplazo de la libc (el proceso es de un solo hilo) ======
+extern "C" {
+
+void* malloc(size_t n) {
+  return allocate(n);
+}
+
+void free(void* p) {
+  if (p) release(header(p));
+}
+
+void* calloc(size_t count, size_t n) {
+  if (n && count > SIM_HEAP_SIZE / n) return nullptr;
+  void* p = allocate(count * n);
+  if (p) memset(p, 0, count * n);
+  return p;
+}
+
+void* realloc(void* p, size_t n) {
+  if (!p) return allocate(n);
+  if (n == 0) {
+    free(p);
+    return nullptr;
+  }
+
+  size_t need = requestSize(n);
+  if (!need) return nullptr;
+
+  Block* b = header(p);
+  size_t size = blockSize(b);
+
+  // Crecer en el lugar si el vecino siguiente está libre y alcanza
+  Block* next = nextBlock(b);
+  if (need > size && !isUsed(next) && size + blockSize(next) >= need) {
+    size_t extra = blockSize(next);
+    listRemove((FreeBlock*)next);
+    g_freeBytes -= extra;
+    size += extra;
+    b->size = size | USED;
+    nextBlock(b)->prevSize = size;
+  }
+
+  if (need <= size) {
+    // Devolver la cola sobrante como bloque libre
+    if (size - need >= MIN_BLOCK) {
+      Block* rest = (Block*)((unsigned char*)b + need);
+      rest->size = (size - need) | USED;
+      rest->prevSize = need;
+      nextBlock(rest)->prevSize = size - need;
+      b->size = need | USED;
+      g_usedBlocks++;  // release() lo descuenta
+      release(rest);
+    }
+    // Recién ahora: al crecer se tomó el vecino entero y la cola ya volvió
+    if (g_freeBytes < g_minFreeBytes) g_minFreeBytes = g_freeBytes;
+    return p;
+  }
+
+  void* q = allocate(n);
+  if (!q) return nullptr;
+  memcpy(q, p, size - HEADER);
+  free(p);
+  return q;
+}
+
+size_t malloc_usable_size(void* p) {
+  return p ? blockSize(header(p)) - HEADER : 0;
+}
+
+int posix_memalign(void** out, size_t alignment, size_t n) {
+  // El sketch no pide alineaciones mayores que la de malloc
+  if (alignment > ALIGN) return ENOMEM;
+  *out = allocate(n);
+  return *out ? 0 : ENOMEM;
+}
+
+void* aligned_alloc(size_t alignment, size_t n) {
+  return alignment > ALIGN ? nullptr : allocate(n);
+}
+
+void* memalign(size_t alignment, size_t n) {
+  return alignment > ALIGN ? nullptr : allocate(n);
+}
+
+}  // extern "C"
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------------------------------
+// HEAP SIMULADO
+/*
+	Reemplaza malloc/free/realloc/calloc de todo el proceso por un first-fit sobre una arena
+	estática de tamaño fijo, como el heap de un ESP32: no crece, no tiene bins por tamaño y
+	un free solo se une con sus vecinos físicos. Asi los patrones de reserva del sketch (y de
+	ArduinoJson, HTTPClient y los buffers TLS) fragmentan igual que en el equipo.
+	Los punteros de 64 bits agrandan los bloques, asi que sirven las tendencias, no los
+	valores absolutos.
+*/
+// -----------------------------------------------------
+#ifndef SIM_HEAP_SIZE
+#define SIM_HEAP_SIZE (320 * 1024)
+#endif
+
+struct SimHeapStats {
+  size_t freeBytes;
+  size_t minFreeBytes;
+  size_t largestFreeBlock;
+  size_t allocatedBlocks;
+  size_t freeBlocks;
+  uint64_t allocCalls;
+  uint64_t failedAllocs;
+};
+
+SimHeapStats simHeapStats();
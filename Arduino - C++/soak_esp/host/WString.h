@@ -0,0 +1,217 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------
+// String como el del core de Arduino
+/*
+	Buffer propio con malloc/realloc y sin reservar de más: cada concat agranda exactamente
+	lo necesario, igual que WString.cpp. Eso es justamente lo que fragmenta el heap en el
+	equipo, asi que no se puede reemplazar por std::string (que duplica la capacidad).
+*/
+// -----------------------------------------------------
+class String {
+ public:
+  String() {}
+  String(const char* s) {
+    if (s) copy(s, strlen(s));
+  }
+  String(const String& s) {
+    copy(s.buf_, s.len_);
+  }
+  String(String&& s) noexcept : buf_(s.buf_), cap_(s.cap_), len_(s.len_) {
+    s.buf_ = nullptr;
+    s.cap_ = s.len_ = 0;
+  }
+  explicit String(char c) {
+    copy(&c, 1);
+  }
+  explicit String(int v) : String((long)v) {}
+  explicit String(unsigned v) : String((unsigned long)v) {}
+  explicit String(long v) {
+    char b[24];
+    copy(b, snprintf(b, sizeof(b), "%ld", v));
+  }
+  explicit String(unsigned long v) {
+    char b[24];
+    copy(b, snprintf(b, sizeof(b), "%lu", v));
+  }
+  ~String() {
+    free(buf_);
+  }
+
+  String& operator=(const String& s) {
+    if (this != &s) copy(s.buf_, s.len_);
+    return *this;
+  }
+  String& operator=(String&& s) noexcept {
+    if (this != &s) {
+      free(buf_);
+      buf_ = s.buf_;
+      cap_ = s.cap_;
+      len_ = s.len_;
+      s.buf_ = nullptr;
+      s.cap_ = s.len_ = 0;
+    }
+    return *this;
+  }
+  String& operator=(const char* s) {
+    if (s) {
+      copy(s, strlen(s));
+    } else {
+      invalidate();
+    }
+    return *this;
+  }
+
+  bool reserve(size_t size) {
+    if (buf_ && cap_ >= size) return true;
+    char* p = (char*)realloc(buf_, size + 1);
+    if (!p) return false;
+    if (!buf_) p[0] = '\0';
+    buf_ = p;
+    cap_ = size;
+    return true;
+  }
+
+  unsigned char concat(const char* s, size_t n) {
+    if (!s) return 0;
+    if (n == 0) return 1;
+    if (!reserve(len_ + n)) return 0;
+    memmove(buf_ + len_, s, n);
+    len_ += n;
+    buf_[len_] = '\0';
+    return 1;
+  }
+  unsigned char concat(const char* s) {
+    return s ? concat(s, strlen(s)) : 0;
+  }
+  unsigned char concat(const String& s) {
+    return concat(s.buf_ ? s.buf_ : "", s.len_);
+  }
+  unsigned char concat(char c) {
+    return concat(&c, 1);
+  }
+  unsigned char concat(long v) {
+    char b[24];
+    return concat(b, snprintf(b, sizeof(b), "%ld", v));
+  }
+  unsigned char concat(int v) {
+    return concat((long)v);
+  }
+  unsigned char concat(unsigned long v) {
+    char b[24];
+    return concat(b, snprintf(b, sizeof(b), "%lu", v));
+  }
+  unsigned char concat(unsigned v) {
+    return concat((unsigned long)v);
+  }
+
+  template <typename T>
+  String& operator+=(const T& v) {
+    concat(v);
+    return *this;
+  }
+
+  size_t length() const {
+    return len_;
+  }
+  const char* c_str() const {
+    return buf_ ? buf_ : "";
+  }
+  bool isEmpty() const {
+    return len_ == 0;
+  }
+  char operator[](unsigned int i) const {
+    return i < len_ ? buf_[i] : 0;
+  }
+
+  int indexOf(char c) const {
+    const char* p = buf_ ? (const char*)memchr(buf_, c, len_) : nullptr;
+    return p ? (int)(p - buf_) : -1;
+  }
+  bool startsWith(const char* prefix) const {
+    size_t n = strlen(prefix);
+    return n <= len_ && memcmp(buf_, prefix, n) == 0;
+  }
+  String substring(unsigned int from) const {
+    return substring(from, len_);
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+      unsigned int t = from;
+      from = to;
+      to = t;
+    }
+    String out;
+    if (from >= len_) return out;
+    if (to > len_) to = len_;
+    out.copy(buf_ + from, to - from);
+    return out;
+  }
+  long toInt() const {
+    return buf_ ? atol(buf_) : 0;
+  }
+
+  bool operator==(const String& s) const {
+    return len_ == s.len_ && strcmp(c_str(), s.c_str()) == 0;
+  }
+  bool operator==(const char* s) const {
+    return strcmp(c_str(), s ? s : "") == 0;
+  }
+  bool operator!=(const String& s) const {
+    return !(*this == s);
+  }
+  bool operator!=(const char* s) const {
+    return !(*this == s);
+  }
+
+ private:
+  void copy(const char* s, size_t n) {
+    if (!reserve(n)) {
+      invalidate();
+      return;
+    }
+    memmove(buf_, s, n);
+    len_ = n;
+    buf_[len_] = '\0';
+  }
+  void invalidate() {
+    free(buf_);
+    buf_ = nullptr;
+    cap_ = len_ = 0;
+  }
+
+  char* buf_ = nullptr;
+  size_t cap_ = 0;
+  size_t len_ = 0;
+};
+
+class StringSumHelper : public String {
+ public:
+  using String::String;
+  StringSumHelper(const String& s) : String(s) {}
+};
+
+template <typename T>
+StringSumHelper operator+(const StringSumHelper& lhs, const T& rhs) {
+  StringSumHelper out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+template <typename T>
+StringSumHelper operator+(const String& lhs, const T& rhs) {
+  StringSumHelper out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+inline StringSumHelper operator+(const char* lhs, const String& rhs) {
+  StringSumHelper out(lhs);
+  out.concat(rhs);
+  return out;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <WiFi.h>
+#include <functional>
+
+typedef enum {
+  HTTP_ANY,
+  HTTP_GET,
+  HTTP_POST
+} HTTPMethod;
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+// Nadie pide /metrics durante el soak: el servidor no hace nada
+class WebServer {
+ public:
+  explicit WebServer(int) {}
+  void on(const char*, HTTPMethod, std::function<void()>) {}
+  void begin() {}
+  void handleClient() {}
+  void setContentLength(size_t) {}
+  void send(int, const char*, const char*) {}
+  void sendContent(const char*) {}
+};
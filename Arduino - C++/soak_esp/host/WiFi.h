@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_CONNECTED = 3,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1
+} wifi_mode_t;
+
+class WiFiClass {
+ public:
+  wl_status_t status() {
+    return begun_ && hostWifiUp() ? WL_CONNECTED : WL_DISCONNECTED;
+  }
+  bool mode(wifi_mode_t) {
+    return true;
+  }
+  wl_status_t begin(const char*, const char* = nullptr) {
+    begun_ = true;
+    return status();
+  }
+  bool reconnect() {
+    return true;
+  }
+  IPAddress localIP() {
+    return IPAddress(192, 168, 0, 50);
+  }
+  int8_t RSSI() {
+    return -61;
+  }
+
+ private:
+  bool begun_ = false;
+};
+
+extern WiFiClass WiFi;
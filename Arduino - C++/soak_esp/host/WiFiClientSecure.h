@@ -0,0 +1,49 @@
+#pragma once
+
+#include <WiFi.h>
+
+// Con TLS la conexión reserva sus buffers al conectar y los libera al cerrar
+class WiFiClient : public Stream {
+ public:
+  virtual ~WiFiClient() {
+    stop();
+  }
+
+  virtual int connect(const char* host, uint16_t port);
+  virtual void stop();
+  bool connected() {
+    return ctx_ != nullptr;
+  }
+
+  size_t write(uint8_t) override {
+    return 1;
+  }
+  size_t write(const uint8_t*, size_t size) override {
+    return size;
+  }
+  using Print::write;
+  int available() override {
+    return 0;
+  }
+  int read() override {
+    return -1;
+  }
+  int peek() override {
+    return -1;
+  }
+
+ protected:
+  void* ctx_ = nullptr;
+};
+
+class WiFiClientSecure : public WiFiClient {
+ public:
+  int connect(const char* host, uint16_t port) override;
+  void stop() override;
+  void setInsecure() {}
+
+ private:
+  // Tamaños de mbedTLS en Arduino-ESP32 (entrada de 16K, salida de 4K)
+  void* inBuf_ = nullptr;
+  void* outBuf_ = nullptr;
+};
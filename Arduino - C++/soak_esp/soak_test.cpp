@@ -0,0 +1,350 @@
+// -----------------------------------------------------
+// SOAK TEST DEL HEAP (PC)
+/*
+	Compila Codigo_esp tal cual contra los shims de host/ y el heap simulado, y lo hace correr
+	dos semanas de reloj virtual en pocos segundos: cada ciclo son 30s de netLoop() más lo que
+	haría linkTask. Firestore responde con listas de meds que cambian de tamaño y contenido,
+	el UNO manda tomas, y cada tanto se cae el WiFi o un pedido devuelve 503.
+	Cada 10 minutos virtuales se toma una muestra con readHeap() (la misma que usa el reporte
+	del equipo). Al final se compara la primera ventana después del arranque contra la última
+	con heapDegraded(): si la fragmentación creció o el bloque libre más grande se achicó, o
+	si falta memoria (fuga) o falló algún malloc, el test termina con código 1.
+
+	Uso: esp_soak [días] [semilla] [-v]
+*/
+// -----------------------------------------------------
+#include <Arduino.h>
+
+#include "../Codigo_esp"
+#include "SimHeap.h"
+
+// ====== Escenario ======
+const uint32_t CYCLE_MS = 30000;
+const uint32_t CYCLES_PER_SAMPLE = 20;        // Una muestra cada 10 minutos virtuales
+const uint32_t MAX_SAMPLES = 8192;
+const uint8_t WINDOW_DIVISOR = 10;            // Arranque, ventana inicial y final = 10% cada una
+const uint32_t LEAK_TOLERANCE_BYTES = 2048;
+
+const uint32_t MEDS_CHANGE_ODDS = 90;         // ~1 cambio cada 45 min
+const uint32_t DISPENSE_ODDS = 120;           // ~1 toma por hora
+const uint32_t WIFI_DROP_ODDS = 700;          // ~2 cortes por día
+const uint32_t HTTP_FAIL_ODDS = 50;           // 2% de los pedidos devuelven 503
+const uint32_t TLS_FAIL_ODDS = 100;           // 1% de los handshakes fallan
+const uint32_t UNLINK_ODDS = 5000;            // Muy de vez en cuando se desvincula
+
+const uint8_t SIM_MAX_MEDS = 6;
+const uint8_t SIM_MAX_TIMES = 3;
+const uint8_t SIM_MAX_NAME = 20;
+
+struct SimMed {
+  char name[SIM_MAX_NAME + 1];
+  bool everyOtherDay;
+  uint8_t timeCount;
+  uint8_t hours[SIM_MAX_TIMES];
+  uint8_t minutes[SIM_MAX_TIMES];
+  uint32_t updateSeq;
+};
+
+SimMed g_simMeds[SIM_MAX_MEDS];
+uint8_t g_simMedCount = 0;
+uint32_t g_simSeq = 0;
+
+bool g_wifiUp = true;
+uint32_t g_wifiDownCycles = 0;
+uint32_t g_unlinkedCycles = 0;
+
+uint32_t g_rng = 1;
+
+// Las respuestas se arman en buffers estáticos para no tocar el heap que se mide
+char g_response[16384];
+HeapSnapshot g_samples[MAX_SAMPLES];
+uint32_t g_sampleCount = 0;
+
+uint32_t simRandom() {
+  g_rng ^= g_rng << 13;
+  g_rng ^= g_rng >> 17;
+  g_rng ^= g_rng << 5;
+  return g_rng;
+}
+
+bool oneIn(uint32_t odds) {
+  return simRandom() % odds == 0;
+}
+
+// ====== Datos de Firestore simulados ======
+void randomizeMed(SimMed& m) {
+  uint8_t len = 3 + simRandom() % (SIM_MAX_NAME - 2);
+  for (uint8_t i = 0; i < len; i++) {
+    m.name[i] = (i == 0 ? 'A' : 'a') + simRandom() % 26;
+  }
+  m.name[len] = '\0';
+  m.everyOtherDay = oneIn(5);
+  m.timeCount = 1 + simRandom() % SIM_MAX_TIMES;
+  for (uint8_t i = 0; i < m.timeCount; i++) {
+    m.hours[i] = simRandom() % 24;
+    m.minutes[i] = simRandom() % 60;
+  }
+  m.updateSeq = ++g_simSeq;
+}
+
+// Alta, baja o edición de una med, como haría la app
+void mutateMeds() {
+  uint32_t op = simRandom() % 3;
+  if ((op == 0 || g_simMedCount == 0) && g_simMedCount < SIM_MAX_MEDS) {
+    randomizeMed(g_simMeds[g_simMedCount++]);
+  } else if (op == 1 && g_simMedCount > 1) {
+    uint8_t i = simRandom() % g_simMedCount;
+    g_simMeds[i] = g_simMeds[--g_simMedCount];
+  } else {
+    randomizeMed(g_simMeds[simRandom() % g_simMedCount]);
+  }
+}
+
+size_t appendf(size_t pos, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+size_t appendf(size_t pos, const char* format, ...) {
+  if (pos >= sizeof(g_response)) return pos;
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(g_response + pos, sizeof(g_response) - pos, format, args);
+  va_end(args);
+  return n < 0 ? pos : pos + n;
+}
+
+// Mismo formato (con sangría) que devuelve la API REST de Firestore
+void buildDeviceDoc() {
+  size_t p = 0;
+  p = appendf(p, "{\n  \"name\": \"projects/%s/databases/(default)/documents/devices/%s\",\n", FIREBASE_PROJECT_ID, DEVICE_ID);
+  p = appendf(p, "  \"fields\": {\n");
+  p = appendf(p, "    \"claimCode\": {\n      \"stringValue\": \"K3D9-7F2L\"\n    },\n");
+  p = appendf(p, "    \"createdAt\": {\n      \"timestampValue\": \"2025-10-21T03:00:00.812Z\"\n    },\n");
+  p = appendf(p, "    \"ownerUID\": {\n      \"stringValue\": \"%s\"\n    }\n",
+              g_unlinkedCycles > 0 ? "" : "0kGVpHZOQCMJpnqkGMW5870FKL33");
+  p = appendf(p, "  },\n  \"createTime\": \"2025-10-21T19:28:13.872908Z\",\n");
+  p = appendf(p, "  \"updateTime\": \"2025-11-19T22:41:22.817440Z\"\n}\n");
+}
+
+void buildMedsList() {
+  size_t p = 0;
+  p = appendf(p, "{\n  \"documents\": [\n");
+  for (uint8_t i = 0; i < g_simMedCount; i++) {
+    const SimMed& m = g_simMeds[i];
+    p = appendf(p, "    {\n      \"name\": \"projects/%s/databases/(default)/documents/users/0kGVpHZOQCMJpnqkGMW5870FKL33/meds/med%08lu\",\n",
+                FIREBASE_PROJECT_ID, (unsigned long)m.updateSeq);
+    p = appendf(p, "      \"fields\": {\n");
+    p = appendf(p, "        \"name\": {\n          \"stringValue\": \"%s\"\n        },\n", m.name);
+    p = appendf(p, "        \"type\": {\n          \"stringValue\": \"%s\"\n        },\n",
+                m.everyOtherDay ? "everyOtherDay" : "everyDay");
+    p = appendf(p, "        \"dosesPerDay\": {\n          \"integerValue\": \"%u\"\n        },\n", m.timeCount);
+    p = appendf(p, "        \"times24h\": {\n          \"arrayValue\": {\n            \"values\": [\n");
+    for (uint8_t t = 0; t < m.timeCount; t++) {
+      p = appendf(p, "              {\n                \"stringValue\": \"%02u:%02u\"\n              }%s\n",
+                  m.hours[t], m.minutes[t], t + 1 < m.timeCount ? "," : "");
+    }
+    p = appendf(p, "            ]\n          }\n        }\n      },\n");
+    p = appendf(p, "      \"createTime\": \"2025-10-21T19:28:13.872908Z\",\n");
+    p = appendf(p, "      \"updateTime\": \"2025-11-%02luT22:41:22.%06luZ\"\n    }%s\n",
+                (unsigned long)(1 + m.updateSeq % 28), (unsigned long)m.updateSeq,
+                i + 1 < g_simMedCount ? "," : "");
+  }
+  p = appendf(p, "  ]\n}\n");
+}
+
+void buildCommitResult(const String& body) {
+  // Un writeResult por cada write del lote
+  size_t p = appendf(0, "{\n  \"writeResults\": [\n");
+  const char* s = body.c_str();
+  bool first = true;
+  while ((s = strstr(s, "\"update\"")) != nullptr) {
+    p = appendf(p, "%s    {\n      \"updateTime\": \"2025-11-19T22:41:22.817440Z\"\n    }", first ? "" : ",\n");
+    first = false;
+    s++;
+  }
+  appendf(p, "\n  ],\n  \"commitTime\": \"2025-11-19T22:41:22.817440Z\"\n}\n");
+}
+
+// ====== Hooks de los shims ======
+int hostHttpRequest(const char* method, const String& url, const String* body, String& response) {
+  if (oneIn(HTTP_FAIL_ODDS)) {
+    response = "{\n  \"error\": {\n    \"code\": 503,\n    \"message\": \"The service is currently unavailable.\",\n    \"status\": \"UNAVAILABLE\"\n  }\n}\n";
+    return 503;
+  }
+
+  if (strcmp(method, "POST") == 0 && strstr(url.c_str(), "documents:commit")) {
+    buildCommitResult(*body);
+  } else if (strstr(url.c_str(), "/documents/devices/")) {
+    buildDeviceDoc();
+  } else if (strstr(url.c_str(), "/meds")) {
+    buildMedsList();
+  } else {
+    response = "{}";
+    return 404;
+  }
+
+  response = g_response;
+  return 200;
+}
+
+bool hostTlsConnect() {
+  return !oneIn(TLS_FAIL_ODDS);
+}
+
+bool hostWifiUp() {
+  return g_wifiUp;
+}
+
+// Una vuelta de linkTask. La pausa entre comandos llama a vTaskDelay(), que vuelve a
+// entrar acá: esa llamada anidada solo avanza el reloj, como si linkTask estuviera dormida
+void hostYield() {
+  static bool inLinkStep = false;
+  if (inLinkStep) return;
+
+  inLinkStep = true;
+  linkStep();
+  inLinkStep = false;
+}
+
+// El UNO avisa una toma de alguna de las alarmas que le cargamos
+void injectDispense() {
+  if (g_unoAlarmCount == 0) return;
+
+  uint32_t localTs = hostEpochAtBoot + millis() / 1000 + GMT_OFFSET_SEC;
+
+  char line[48];
+  snprintf(line, sizeof(line), "DISP:%lu:%lu:%lu\n",
+           (unsigned long)(simRandom() % 8),
+           (unsigned long)localTs,
+           (unsigned long)(simRandom() % g_unoAlarmCount));
+  Serial2.inject(line);
+}
+
+// ====== Ciclo de simulación ======
+void simulateEnvironment() {
+  if (g_wifiDownCycles > 0) {
+    if (--g_wifiDownCycles == 0) g_wifiUp = true;
+  } else if (oneIn(WIFI_DROP_ODDS)) {
+    g_wifiUp = false;
+    g_wifiDownCycles = 2 + simRandom() % 40;
+  }
+
+  if (g_unlinkedCycles > 0) {
+    g_unlinkedCycles--;
+  } else if (oneIn(UNLINK_ODDS)) {
+    g_unlinkedCycles = 1 + simRandom() % 10;
+  }
+
+  if (oneIn(MEDS_CHANGE_ODDS)) mutateMeds();
+  if (oneIn(DISPENSE_ODDS)) injectDispense();
+}
+
+HeapSnapshot windowMean(uint32_t from, uint32_t to) {
+  uint64_t freeBytes = 0, largest = 0, minFree = 0, used = 0, freeBlocks = 0, frag = 0;
+  for (uint32_t i = from; i < to; i++) {
+    freeBytes += g_samples[i].freeBytes;
+    largest += g_samples[i].largestBlock;
+    minFree += g_samples[i].minFreeBytes;
+    used += g_samples[i].allocatedBlocks;
+    freeBlocks += g_samples[i].freeBlocks;
+    frag += g_samples[i].fragPct;
+  }
+  uint32_t n = to - from;
+  HeapSnapshot h;
+  h.freeBytes = freeBytes / n;
+  h.largestBlock = largest / n;
+  h.minFreeBytes = minFree / n;
+  h.allocatedBlocks = used / n;
+  h.freeBlocks = freeBlocks / n;
+  h.fragPct = frag / n;
+  return h;
+}
+
+void printSnapshot(const char* label, const HeapSnapshot& h) {
+  printf("%-8s libre=%7lu bloque=%7lu frag=%3u%% usados=%5lu libres=%4lu\n", label,
+         (unsigned long)h.freeBytes, (unsigned long)h.largestBlock, h.fragPct,
+         (unsigned long)h.allocatedBlocks, (unsigned long)h.freeBlocks);
+}
+
+int main(int argc, char** argv) {
+  uint32_t days = 14;
+  uint32_t seed = 1;
+  uint8_t positional = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-v") == 0) {
+      hostVerbose = true;
+    } else if (positional++ == 0) {
+      days = strtoul(argv[i], nullptr, 10);
+    } else {
+      seed = strtoul(argv[i], nullptr, 10);
+    }
+  }
+  g_rng = seed ? seed : 1;
+
+  uint32_t cycles = days * 24 * 3600 / (CYCLE_MS / 1000);
+  if (cycles / CYCLES_PER_SAMPLE > MAX_SAMPLES) cycles = MAX_SAMPLES * CYCLES_PER_SAMPLE;
+
+  for (uint8_t i = 0; i < 3; i++) mutateMeds();
+
+  // Lo mismo que setup() + el arranque de netTask
+  setup();
+  conectarWifi();
+  if (syncNTPTime()) requestTimeToArduino();
+  attemptSync(true);
+  hostYield();
+
+  for (uint32_t c = 1; c <= cycles; c++) {
+    simulateEnvironment();
+    hostAdvanceMs(CYCLE_MS + simRandom() % 500);
+    netLoop();
+    hostYield();
+
+    if (c % CYCLES_PER_SAMPLE == 0 && g_sampleCount < MAX_SAMPLES) {
+      g_samples[g_sampleCount++] = readHeap();
+    }
+    if (c % (24 * 3600 / (CYCLE_MS / 1000)) == 0) {
+      char label[16];
+      snprintf(label, sizeof(label), "día %lu", (unsigned long)(c * (CYCLE_MS / 1000) / 86400));
+      printSnapshot(label, readHeap());
+    }
+  }
+
+  if (g_sampleCount < WINDOW_DIVISOR * 3) {
+    printf("❌ Muy pocas muestras (%lu), correr al menos un día\n", (unsigned long)g_sampleCount);
+    return 1;
+  }
+
+  uint32_t window = g_sampleCount / WINDOW_DIVISOR;
+  HeapSnapshot base = windowMean(window, 2 * window);
+  HeapSnapshot end = windowMean(g_sampleCount - window, g_sampleCount);
+  SimHeapStats stats = simHeapStats();
+
+  printf("\n");
+  printSnapshot("inicio", base);
+  printSnapshot("final", end);
+  printf("mallocs=%llu fallidos=%llu http=%lu sync=%lu/%lu tomas=%lu subidas=%lu\n",
+         (unsigned long long)stats.allocCalls, (unsigned long long)stats.failedAllocs,
+         (unsigned long)g_counters[CNT_HTTP_REQUESTS],
+         (unsigned long)g_counters[CNT_SYNC_OK], (unsigned long)g_counters[CNT_SYNC_FAIL],
+         (unsigned long)g_counters[CNT_DISPENSE_EVENTS],
+         (unsigned long)g_counters[CNT_DISPENSE_UPLOADED]);
+
+  bool ok = true;
+  if (heapDegraded(base, end)) {
+    printf("❌ El heap se fragmentó: frag %u%% -> %u%%, bloque %lu -> %lu\n",
+           base.fragPct, end.fragPct,
+           (unsigned long)base.largestBlock, (unsigned long)end.largestBlock);
+    ok = false;
+  }
+  if (end.freeBytes + LEAK_TOLERANCE_BYTES < base.freeBytes) {
+    printf("❌ Fuga de memoria: libre %lu -> %lu\n",
+           (unsigned long)base.freeBytes, (unsigned long)end.freeBytes);
+    ok = false;
+  }
+  if (stats.failedAllocs > 0) {
+    printf("❌ %llu mallocs fallaron\n", (unsigned long long)stats.failedAllocs);
+    ok = false;
+  }
+
+  printf(ok ? "✅ Heap estable después de %lu días\n" : "❌ Soak test fallido (%lu días)\n",
+         (unsigned long)days);
+  return ok ? 0 : 1;
+}